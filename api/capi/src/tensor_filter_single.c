@@ -363,7 +363,7 @@ g_tensor_filter_single_invoke (GTensorFilterSingle * self,
   /** Setup output buffer */
   for (i = 0; i < priv->prop.output_meta.num_tensors; i++) {
     /* allocate memory if allocate_in_invoke is FALSE */
-    if (priv->fw->allocate_in_invoke == FALSE) {
+    if (priv->allocate_in_invoke == FALSE) {
       output[i].data = g_malloc (output[i].size);
       if (!output[i].data)
         goto error;
@@ -374,7 +374,7 @@ g_tensor_filter_single_invoke (GTensorFilterSingle * self,
     return TRUE;
 
 error:
-  if (priv->fw->allocate_in_invoke == FALSE)
+  if (priv->allocate_in_invoke == FALSE)
     for (i = 0; i < priv->prop.output_meta.num_tensors; i++)
       g_free (output[i].data);
   return FALSE;
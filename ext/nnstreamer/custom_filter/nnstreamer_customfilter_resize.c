@@ -0,0 +1,565 @@
+/**
+ * NNStreamer Custom Filter "Resize"
+ * Copyright (C) 2019 Samsung Electronics Co., Ltd.
+ *
+ * LICENSE: LGPL-2.1
+ *
+ * @file  nnstreamer_customfilter_resize.c
+ * @date  18 Oct 2019
+ * @brief  Custom NNStreamer Filter "Resize" to resize the images in tensor space
+ * @bug  No known bugs
+ *
+ * This resizes a tensor of [C][W][H][N] to [C][new-W][new-H][N], where the type is uint8 or float32.
+ * Unlike "Scaler" example, this is installed with NNStreamer and supposed to be used for the images in a pipeline.
+ *
+ * The custom property is to be given as, "custom=[new-x]x[new-y],mode:[mode],threads:[num]"
+ * E.g., custom=300x300,mode:area,threads:2
+ *
+ * - mode : bilinear (default), area or nearest.
+ *          area is for downscaling, and works as bilinear for upscaling.
+ *          nearest is same with "Scaler" example.
+ * - threads : the number of threads to process the rows of an image. (default 1, 0 for the number of processors)
+ *
+ * The image is resized with separable passes, horizontal pass for the rows of input and vertical pass
+ * for the rows of output, with the coefficient tables computed once for the dimensions.
+ * The inner loops of passes are written to be vectorized by compiler.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <glib.h>
+#include <tensor_filter_custom.h>
+#include <nnstreamer_plugin_api.h>
+
+/**
+ * @brief The modes to resize the image.
+ */
+typedef enum
+{
+  RESIZE_BILINEAR = 0,
+  RESIZE_AREA,
+  RESIZE_NEAREST,
+} resize_mode;
+
+/**
+ * @brief The coefficient table for one direction.
+ * @note The output pixel [i] = sum (input pixel [offset[i] + t] * weights[i * max_taps + t]) for t < ntaps[i].
+ */
+typedef struct _resize_coeff
+{
+  uint32_t in_size; /**< The size of input */
+  uint32_t out_size; /**< The size of output */
+  uint32_t max_taps; /**< The max number of taps */
+  uint32_t *offset; /**< The first input pixel of each output pixel */
+  uint32_t *ntaps; /**< The number of taps of each output pixel */
+  float *weights; /**< The weights (out_size x max_taps) */
+} resize_coeff;
+
+/**
+ * @brief The pass of the resize task.
+ */
+typedef enum
+{
+  RESIZE_PASS_HORIZONTAL = 0,
+  RESIZE_PASS_VERTICAL,
+} resize_pass;
+
+/**
+ * @brief Custom filter's private data.
+ */
+typedef struct _rz_data
+{
+  uint32_t new_x; /**< The width of output */
+  uint32_t new_y; /**< The height of output */
+  resize_mode mode; /**< The mode to resize */
+  uint32_t num_threads; /**< The number of threads to process the rows */
+
+  resize_coeff coeff_x; /**< The coefficient table for width */
+  resize_coeff coeff_y; /**< The coefficient table for height */
+
+  float *buffer; /**< The intermediate buffer (input height x output width x channel) */
+  size_t buffer_size; /**< The number of elements in the buffer */
+
+  GThreadPool *pool; /**< The thread pool to process the rows */
+  GMutex lock; /**< The lock for the jobs */
+  GCond cond; /**< The condition to wait for the jobs */
+  uint32_t pending; /**< The number of pending jobs */
+
+  /* The current task */
+  resize_pass pass; /**< The pass to process */
+  tensor_type type; /**< The type of tensor */
+  uint32_t channel; /**< The number of channels */
+  uint32_t total_rows; /**< The number of rows to process */
+  const void *in; /**< The input frame */
+  void *out; /**< The output frame */
+} rz_data;
+
+/**
+ * @brief Free the coefficient table.
+ */
+static void
+resize_coeff_free (resize_coeff * coeff)
+{
+  g_free (coeff->offset);
+  g_free (coeff->ntaps);
+  g_free (coeff->weights);
+  memset (coeff, 0, sizeof (resize_coeff));
+}
+
+/**
+ * @brief Compute the coefficient table for one direction.
+ */
+static void
+resize_coeff_compute (resize_coeff * coeff, uint32_t in_size,
+    uint32_t out_size, resize_mode mode)
+{
+  double scale = (double) in_size / out_size;
+  uint32_t i, t;
+
+  if (coeff->in_size == in_size && coeff->out_size == out_size)
+    return;
+
+  resize_coeff_free (coeff);
+
+  /* area is for downscaling */
+  if (mode == RESIZE_AREA && scale <= 1.0)
+    mode = RESIZE_BILINEAR;
+
+  switch (mode) {
+    case RESIZE_NEAREST:
+      coeff->max_taps = 1;
+      break;
+    case RESIZE_AREA:
+      coeff->max_taps = (uint32_t) ceil (scale) + 1;
+      break;
+    case RESIZE_BILINEAR:
+    default:
+      coeff->max_taps = 2;
+      break;
+  }
+
+  coeff->in_size = in_size;
+  coeff->out_size = out_size;
+  coeff->offset = g_new0 (uint32_t, out_size);
+  coeff->ntaps = g_new0 (uint32_t, out_size);
+  coeff->weights = g_new0 (float, out_size * coeff->max_taps);
+
+  for (i = 0; i < out_size; i++) {
+    float *w = coeff->weights + i * coeff->max_taps;
+
+    switch (mode) {
+      case RESIZE_NEAREST:
+        /* same with the example "Scaler" */
+        coeff->offset[i] = (uint32_t) ((uint64_t) i * in_size / out_size);
+        coeff->ntaps[i] = 1;
+        w[0] = 1.0f;
+        break;
+      case RESIZE_AREA:
+      {
+        double start = i * scale;
+        double end = start + scale;
+        uint32_t first = (uint32_t) floor (start);
+        uint32_t last = MIN ((uint32_t) ceil (end), in_size);
+
+        coeff->offset[i] = first;
+        coeff->ntaps[i] = 0;
+
+        for (t = first; t < last && coeff->ntaps[i] < coeff->max_taps; t++) {
+          double overlap = MIN (end, (double) t + 1) - MAX (start, (double) t);
+
+          if (overlap <= 0.0)
+            continue;
+
+          w[t - first] = (float) (overlap / scale);
+          coeff->ntaps[i] = t - first + 1;
+        }
+        break;
+      }
+      case RESIZE_BILINEAR:
+      default:
+      {
+        /* half-pixel centers */
+        double src = (i + 0.5) * scale - 0.5;
+        uint32_t x0;
+
+        if (src < 0.0)
+          src = 0.0;
+
+        x0 = (uint32_t) floor (src);
+        if (x0 >= in_size - 1) {
+          coeff->offset[i] = in_size - 1;
+          coeff->ntaps[i] = 1;
+          w[0] = 1.0f;
+        } else {
+          coeff->offset[i] = x0;
+          coeff->ntaps[i] = 2;
+          w[1] = (float) (src - x0);
+          w[0] = 1.0f - w[1];
+        }
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Resize a row of input horizontally.
+ * @param[in] in The row of input (in_size x channel)
+ * @param[out] out The row of intermediate buffer (out_size x channel)
+ */
+#define RESIZE_HORIZONTAL_ROW(itype,in,out,coeff,channel) do { \
+      const itype *_in = (const itype *) (in); \
+      uint32_t _x, _t, _c; \
+      for (_x = 0; _x < (coeff)->out_size; _x++) { \
+        const itype *_src = _in + (coeff)->offset[_x] * (channel); \
+        const float *_w = (coeff)->weights + _x * (coeff)->max_taps; \
+        float *_dst = (out) + _x * (channel); \
+        for (_c = 0; _c < (channel); _c++) \
+          _dst[_c] = 0.0f; \
+        for (_t = 0; _t < (coeff)->ntaps[_x]; _t++) { \
+          for (_c = 0; _c < (channel); _c++) \
+            _dst[_c] += _w[_t] * (float) _src[_t * (channel) + _c]; \
+        } \
+      } \
+    } while (0)
+
+/**
+ * @brief Process the rows of horizontal pass.
+ */
+static void
+resize_horizontal (rz_data * data, uint32_t start, uint32_t end)
+{
+  uint32_t y;
+  size_t in_row = (size_t) data->coeff_x.in_size * data->channel;
+  size_t out_row = (size_t) data->coeff_x.out_size * data->channel;
+
+  for (y = start; y < end; y++) {
+    float *out = data->buffer + y * out_row;
+
+    if (data->type == _NNS_UINT8) {
+      RESIZE_HORIZONTAL_ROW (uint8_t, (const uint8_t *) data->in + y * in_row,
+          out, &data->coeff_x, data->channel);
+    } else {
+      RESIZE_HORIZONTAL_ROW (float, (const float *) data->in + y * in_row,
+          out, &data->coeff_x, data->channel);
+    }
+  }
+}
+
+/**
+ * @brief Process the rows of vertical pass.
+ */
+static void
+resize_vertical (rz_data * data, uint32_t start, uint32_t end)
+{
+  uint32_t y, t;
+  size_t i, row = (size_t) data->coeff_x.out_size * data->channel;
+  float *acc = NULL;
+
+  if (data->type == _NNS_UINT8)
+    acc = g_new (float, row);
+
+  for (y = start; y < end; y++) {
+    const float *w = data->coeff_y.weights + y * data->coeff_y.max_taps;
+    const float *src = data->buffer + data->coeff_y.offset[y] * row;
+    float *dst = (data->type == _NNS_UINT8) ?
+        acc : (float *) data->out + y * row;
+
+    for (i = 0; i < row; i++)
+      dst[i] = w[0] * src[i];
+
+    for (t = 1; t < data->coeff_y.ntaps[y]; t++) {
+      const float *s = src + t * row;
+      const float wt = w[t];
+
+      for (i = 0; i < row; i++)
+        dst[i] += wt * s[i];
+    }
+
+    if (data->type == _NNS_UINT8) {
+      uint8_t *out = (uint8_t *) data->out + y * row;
+
+      for (i = 0; i < row; i++) {
+        float v = acc[i] + 0.5f;
+
+        out[i] = (v <= 0.0f) ? 0 : ((v >= 255.0f) ? 255 : (uint8_t) v);
+      }
+    }
+  }
+
+  g_free (acc);
+}
+
+/**
+ * @brief Process a part of the rows of current task.
+ */
+static void
+resize_run_job (rz_data * data, uint32_t job)
+{
+  uint32_t chunk = (data->total_rows + data->num_threads - 1) /
+      data->num_threads;
+  uint32_t start = job * chunk;
+  uint32_t end = MIN (start + chunk, data->total_rows);
+
+  if (start >= end)
+    return;
+
+  if (data->pass == RESIZE_PASS_HORIZONTAL)
+    resize_horizontal (data, start, end);
+  else
+    resize_vertical (data, start, end);
+}
+
+/**
+ * @brief The function of thread pool.
+ */
+static void
+resize_thread_func (gpointer job, gpointer user_data)
+{
+  rz_data *data = user_data;
+
+  resize_run_job (data, GPOINTER_TO_UINT (job) - 1);
+
+  g_mutex_lock (&data->lock);
+  data->pending--;
+  g_cond_signal (&data->cond);
+  g_mutex_unlock (&data->lock);
+}
+
+/**
+ * @brief Process the rows of current task with the threads.
+ */
+static void
+resize_run_pass (rz_data * data, resize_pass pass, uint32_t total_rows)
+{
+  uint32_t job;
+
+  data->pass = pass;
+  data->total_rows = total_rows;
+
+  if (data->pool == NULL) {
+    resize_run_job (data, 0);
+    return;
+  }
+
+  g_mutex_lock (&data->lock);
+  data->pending = data->num_threads - 1;
+  g_mutex_unlock (&data->lock);
+
+  /* job index starts from 1 to avoid NULL */
+  for (job = 1; job < data->num_threads; job++)
+    g_thread_pool_push (data->pool, GUINT_TO_POINTER (job + 1), NULL);
+
+  /* the caller processes the first part */
+  resize_run_job (data, 0);
+
+  g_mutex_lock (&data->lock);
+  while (data->pending > 0)
+    g_cond_wait (&data->cond, &data->lock);
+  g_mutex_unlock (&data->lock);
+}
+
+/**
+ * @brief tensor_filter_custom::NNS_custom_init_func
+ */
+static void *
+rz_init (const GstTensorFilterProperties * prop)
+{
+  rz_data *data = g_new0 (rz_data, 1);
+  gchar **options;
+  guint i;
+
+  data->mode = RESIZE_BILINEAR;
+  data->num_threads = 1;
+
+  g_mutex_init (&data->lock);
+  g_cond_init (&data->cond);
+
+  /* Parse property and set new_x, new_y, mode and threads */
+  if (prop->custom_properties && strlen (prop->custom_properties) > 0) {
+    options = g_strsplit (prop->custom_properties, ",", -1);
+
+    for (i = 0; i < g_strv_length (options); i++) {
+      gchar **option = g_strsplit (options[i], ":", -1);
+
+      if (g_strv_length (option) > 1) {
+        g_strstrip (option[0]);
+        g_strstrip (option[1]);
+
+        if (g_ascii_strcasecmp (option[0], "mode") == 0) {
+          if (g_ascii_strcasecmp (option[1], "area") == 0)
+            data->mode = RESIZE_AREA;
+          else if (g_ascii_strcasecmp (option[1], "nearest") == 0)
+            data->mode = RESIZE_NEAREST;
+          else if (g_ascii_strcasecmp (option[1], "bilinear") == 0)
+            data->mode = RESIZE_BILINEAR;
+          else
+            g_warning ("Unknown resize mode %s, use bilinear.", option[1]);
+        } else if (g_ascii_strcasecmp (option[0], "threads") == 0) {
+          data->num_threads = (uint32_t) g_ascii_strtoull (option[1], NULL, 10);
+        } else {
+          g_warning ("Unknown option (%s).", options[i]);
+        }
+      } else {
+        gchar **size = g_strsplit_set (options[i], "xX", 3);
+
+        if (size[0] != NULL)
+          data->new_x = (uint32_t) g_ascii_strtoll (size[0], NULL, 10);
+        if (size[0] != NULL && size[1] != NULL)
+          data->new_y = (uint32_t) g_ascii_strtoll (size[1], NULL, 10);
+        g_strfreev (size);
+      }
+
+      g_strfreev (option);
+    }
+
+    g_strfreev (options);
+  }
+
+  if (data->num_threads == 0)
+    data->num_threads = g_get_num_processors ();
+
+  if (data->num_threads > 1) {
+    data->pool = g_thread_pool_new (resize_thread_func, data,
+        data->num_threads - 1, TRUE, NULL);
+    if (data->pool == NULL)
+      data->num_threads = 1;
+  }
+
+  return data;
+}
+
+/**
+ * @brief tensor_filter_custom::NNS_custom_exit_func
+ */
+static void
+rz_exit (void *private_data, const GstTensorFilterProperties * prop)
+{
+  rz_data *data = private_data;
+  assert (data);
+
+  if (data->pool)
+    g_thread_pool_free (data->pool, TRUE, TRUE);
+
+  resize_coeff_free (&data->coeff_x);
+  resize_coeff_free (&data->coeff_y);
+  g_free (data->buffer);
+
+  g_mutex_clear (&data->lock);
+  g_cond_clear (&data->cond);
+  g_free (data);
+}
+
+/**
+ * @brief tensor_filter_custom::NNS_custom_set_input_dimension
+ */
+static int
+set_inputDim (void *private_data, const GstTensorFilterProperties * prop,
+    const GstTensorsInfo * in_info, GstTensorsInfo * out_info)
+{
+  int i;
+  rz_data *data = private_data;
+
+  assert (data);
+  assert (in_info);
+  assert (out_info);
+
+  if (in_info->num_tensors != 1)
+    return -1;
+
+  if (in_info->info[0].type != _NNS_UINT8 &&
+      in_info->info[0].type != _NNS_FLOAT32)
+    return -1;
+
+  out_info->num_tensors = 1;
+
+  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++)
+    out_info->info[0].dimension[i] = in_info->info[0].dimension[i];
+
+  /* Update [1] and [2] oDim with new-x, new-y */
+  if (data->new_x > 0)
+    out_info->info[0].dimension[1] = data->new_x;
+  if (data->new_y > 0)
+    out_info->info[0].dimension[2] = data->new_y;
+
+  out_info->info[0].type = in_info->info[0].type;
+  return 0;
+}
+
+/**
+ * @brief tensor_filter_custom::NNS_custom_invoke
+ */
+static int
+rz_invoke (void *private_data, const GstTensorFilterProperties * prop,
+    const GstTensorMemory * input, GstTensorMemory * output)
+{
+  rz_data *data = private_data;
+  const GstTensorInfo *in_info, *out_info;
+  uint32_t c, iw, ih, ow, oh, n, z;
+  size_t elementsize, buffer_size;
+
+  assert (data);
+  assert (input);
+  assert (output);
+
+  /* This assumes the limit is 4 */
+  assert (NNS_TENSOR_RANK_LIMIT == 4);
+
+  in_info = &prop->input_meta.info[0];
+  out_info = &prop->output_meta.info[0];
+
+  assert (in_info->dimension[0] == out_info->dimension[0]);
+  assert (in_info->dimension[3] == out_info->dimension[3]);
+  assert (in_info->type == out_info->type);
+  assert (input[0].data != output[0].data);
+
+  c = in_info->dimension[0];
+  iw = in_info->dimension[1];
+  ih = in_info->dimension[2];
+  n = in_info->dimension[3];
+  ow = out_info->dimension[1];
+  oh = out_info->dimension[2];
+
+  if (in_info->type != _NNS_UINT8 && in_info->type != _NNS_FLOAT32)
+    return -1;
+
+  resize_coeff_compute (&data->coeff_x, iw, ow, data->mode);
+  resize_coeff_compute (&data->coeff_y, ih, oh, data->mode);
+
+  buffer_size = (size_t) ih * ow * c;
+  if (data->buffer_size < buffer_size) {
+    g_free (data->buffer);
+    data->buffer = g_new (float, buffer_size);
+    data->buffer_size = buffer_size;
+  }
+
+  elementsize = gst_tensor_get_element_size (in_info->type);
+
+  data->type = in_info->type;
+  data->channel = c;
+
+  for (z = 0; z < n; z++) {
+    data->in = (const uint8_t *) input[0].data +
+        (size_t) z * c * iw * ih * elementsize;
+    data->out = (uint8_t *) output[0].data +
+        (size_t) z * c * ow * oh * elementsize;
+
+    resize_run_pass (data, RESIZE_PASS_HORIZONTAL, ih);
+    resize_run_pass (data, RESIZE_PASS_VERTICAL, oh);
+  }
+
+  return 0;
+}
+
+static NNStreamer_custom_class NNStreamer_custom_body = {
+  .initfunc = rz_init,
+  .exitfunc = rz_exit,
+  .setInputDim = set_inputDim,
+  .invoke = rz_invoke,
+};
+
+/* The dyn-loaded object */
+NNStreamer_custom_class *NNStreamer_custom = &NNStreamer_custom_body;
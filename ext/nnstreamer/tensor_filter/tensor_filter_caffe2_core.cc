@@ -34,7 +34,10 @@
 #define DBG FALSE
 #endif
 
-std::map <char*, Tensor*> Caffe2Core::inputTensorMap;
+std::map <void*, Tensor*> Caffe2Core::outputTensorMap;
+std::mutex Caffe2Core::outputTensorLock;
+std::map <std::string, std::weak_ptr <Workspace>> Caffe2Core::weightSpaceMap;
+std::mutex Caffe2Core::weightSpaceLock;
 
 /**
  * @brief	Caffe2Core creator
@@ -57,6 +60,10 @@ Caffe2Core::Caffe2Core (const char * _model_path, const char *_model_path_sub)
  */
 Caffe2Core::~Caffe2Core ()
 {
+  /* the workspace of this instance refers the shared one */
+  workSpace.reset ();
+  weightSpace.reset ();
+
   gst_tensors_info_free (&inputTensorMeta);
   gst_tensors_info_free (&outputTensorMeta);
 }
@@ -83,6 +90,9 @@ Caffe2Core::init (const GstTensorFilterProperties * prop)
     g_critical ("Failed to initialize input tensor\n");
     return -2;
   }
+
+  /* the net should be created after the input blobs of this workspace */
+  CAFFE_ENFORCE (workSpace->CreateNet (predictNet));
   return 0;
 }
 
@@ -102,14 +112,16 @@ do {\
 
 /**
  * @brief initialize the input tensor
+ * @note The input blobs are created in the workspace of this instance,
+ *       even if the init-net defines the blobs with same name.
  */
 int
 Caffe2Core::initInputTensor ()
 {
   int i = 0;
-  inputTensorMap.clear ();
+  inputTensors.clear ();
   for (; i < inputTensorMeta.num_tensors; i++) {
-    Tensor *inputTensor = workSpace.CreateBlob (inputTensorMeta.info[i].name)
+    Tensor *inputTensor = workSpace->CreateLocalBlob (inputTensorMeta.info[i].name)
       ->GetMutable<Tensor> ();
 
     switch (inputTensorMeta.info[i].type){
@@ -148,9 +160,7 @@ Caffe2Core::initInputTensor ()
         return -1;
     }
 
-    inputTensorMap.insert (
-      std::make_pair (inputTensorMeta.info[i].name, inputTensor)
-    );
+    inputTensors.push_back (inputTensor);
   }
   return 0;
 }
@@ -208,8 +218,23 @@ Caffe2Core::loadModels ()
       initNet.mutable_op(i)->mutable_device_option()->set_device_type(PROTO_CPU);
   }
 
-  CAFFE_ENFORCE (workSpace.RunNetOnce (initNet));
-  CAFFE_ENFORCE (workSpace.CreateNet (predictNet));
+  /* the weights are loaded once and shared with the instances of same init-net */
+  {
+    std::lock_guard <std::mutex> lock (weightSpaceLock);
+    auto it = weightSpaceMap.find (init_model_path);
+
+    if (it != weightSpaceMap.end ())
+      weightSpace = it->second.lock ();
+
+    if (!weightSpace) {
+      weightSpace = std::make_shared <Workspace> ();
+      CAFFE_ENFORCE (weightSpace->RunNetOnce (initNet));
+      weightSpaceMap[init_model_path] = weightSpace;
+    }
+  }
+
+  /* each instance runs the predict-net in its own workspace */
+  workSpace.reset (new Workspace (weightSpace.get ()));
 #if (DBG)
   gint64 stop_time = g_get_real_time ();
   g_message ("Model is loaded: %" G_GINT64_FORMAT, (stop_time - start_time));
@@ -257,10 +282,8 @@ Caffe2Core::run (const GstTensorMemory * input, GstTensorMemory * output)
   gint64 start_time = g_get_real_time ();
 #endif
   for (i = 0; i < inputTensorMeta.num_tensors; i++){
-    Tensor *inputTensor = inputTensorMap.
-                            find(inputTensorMeta.info[i].name)->second;
-    inputTensor->ShareExternalPointer ((float*) input[i].data);
-    switch (outputTensorMeta.info[i].type){
+    Tensor *inputTensor = inputTensors[i];
+    switch (inputTensorMeta.info[i].type){
       case _NNS_INT32:
         inputTensor->ShareExternalPointer ((int32_t*) input[i].data);
         break;
@@ -297,47 +320,61 @@ Caffe2Core::run (const GstTensorMemory * input, GstTensorMemory * output)
     }
   }
 
-  workSpace.RunNet (predictNet.name ());
+  workSpace->RunNet (predictNet.name ());
 
   for (i = 0; i < outputTensorMeta.num_tensors; i++) {
-    const auto& out = workSpace.GetBlob (outputTensorMeta.info[i].name)
-      ->Get<Tensor> ();
+    Tensor *blobTensor = workSpace->GetBlob (outputTensorMeta.info[i].name)
+      ->GetMutable<Tensor> ();
+
+    /**
+     * Hand over the output tensor to the pipeline, and leave an empty tensor in the blob.
+     * The next run allocates a new one, so the downstream can hold the output without copy.
+     */
+    Tensor *outTensor = new Tensor (std::move (*blobTensor));
+    *blobTensor = Tensor (CPU);
+    const auto& out = *outTensor;
 
     switch (outputTensorMeta.info[i].type){
       case _NNS_INT32:
-        output[i].data = out.data<int32_t>();
+        output[i].data = (void *) out.data<int32_t>();
         break;
       case _NNS_UINT32:
         g_critical ("invalid data type is used");
+        delete outTensor;
         return -1;
       case _NNS_INT16:
-        output[i].data = out.data<int16_t>();
+        output[i].data = (void *) out.data<int16_t>();
         break;
       case _NNS_UINT16:
-        output[i].data = out.data<uint16_t>();
+        output[i].data = (void *) out.data<uint16_t>();
         break;
       case _NNS_INT8:
-        output[i].data = out.data<int8_t>();
+        output[i].data = (void *) out.data<int8_t>();
         break;
       case _NNS_UINT8:
-        output[i].data = out.data<uint8_t>();
+        output[i].data = (void *) out.data<uint8_t>();
         break;
       case _NNS_FLOAT64:
-        output[i].data = out.data<double>();
+        output[i].data = (void *) out.data<double>();
         break;
       case _NNS_FLOAT32:
-        output[i].data = out.data<float>();
+        output[i].data = (void *) out.data<float>();
         break;
       case _NNS_INT64:
-        output[i].data = out.data<int64_t>();
+        output[i].data = (void *) out.data<int64_t>();
         break;
       case _NNS_UINT64:
         g_critical ("invalid data type is used");
+        delete outTensor;
         return -1;
       default:
         g_critical ("invalid data type is used");
+        delete outTensor;
         return -1;
     }
+
+    std::lock_guard <std::mutex> lock (outputTensorLock);
+    outputTensorMap.insert (std::make_pair (output[i].data, outTensor));
   }
 
 #if (DBG)
@@ -456,5 +493,17 @@ caffe2_core_run (void * caffe2, const GstTensorMemory * input,
 void
 caffe2_core_destroyNotify (void * data)
 {
-  /* do nothing */
+  Tensor *tensor = nullptr;
+
+  {
+    std::lock_guard <std::mutex> lock (Caffe2Core::outputTensorLock);
+    auto it = Caffe2Core::outputTensorMap.find (data);
+
+    if (it != Caffe2Core::outputTensorMap.end ()) {
+      tensor = it->second;
+      Caffe2Core::outputTensorMap.erase (it);
+    }
+  }
+
+  delete tensor;
 }
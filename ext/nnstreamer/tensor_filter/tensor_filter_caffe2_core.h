@@ -28,6 +28,11 @@
 
 #ifdef __cplusplus
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "caffe2/core/workspace.h"
 #include "caffe2/core/init.h"
@@ -51,6 +56,9 @@ public:
   int getOutputTensorDim (GstTensorsInfo * info);
   int run (const GstTensorMemory * input, GstTensorMemory * output);
 
+  static std::map <void*, Tensor*> outputTensorMap;
+  static std::mutex outputTensorLock;
+
 private:
 
   const char *init_model_path;
@@ -59,9 +67,13 @@ private:
   GstTensorsInfo inputTensorMeta;  /**< The tensor info of input tensors */
   GstTensorsInfo outputTensorMeta;  /**< The tensor info of output tensors */
 
-  Workspace workSpace;
+  std::shared_ptr <Workspace> weightSpace; /**< The workspace with the weights from init-net, shared with the instances of same model */
+  std::unique_ptr <Workspace> workSpace; /**< The workspace of this instance to run predict-net */
   NetDef initNet, predictNet;
-  static std::map <char*, Tensor*> inputTensorMap;
+  std::vector <Tensor*> inputTensors; /**< The input tensors in the workspace of this instance */
+
+  static std::map <std::string, std::weak_ptr <Workspace>> weightSpaceMap;
+  static std::mutex weightSpaceLock;
 
   int initInputTensor ();
 };
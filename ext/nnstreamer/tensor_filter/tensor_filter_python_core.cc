@@ -31,7 +31,15 @@
 #define DBG FALSE
 #endif
 
-std::map <void*, PyArrayObject*> PYCore::outputArrayMap;
+std::vector <py_output_slot_s> PYCore::outputSlots;
+std::mutex PYCore::outputSlotsLock;
+
+/**
+ * @brief The python interpreter is shared with all instances in the process.
+ */
+static GMutex py_init_lock;
+static guint py_init_count = 0;
+static PyThreadState *py_main_state = NULL;
 
 /**
  * @brief	PYCore creator
@@ -59,9 +67,20 @@ PYCore::PYCore (const char* _script_path, const char* _custom)
   handle = dlopen(libname, RTLD_LAZY | RTLD_GLOBAL);
   g_assert(handle);
 
-  Py_Initialize();
+  g_mutex_lock (&py_init_lock);
+  if (py_init_count++ == 0 && !Py_IsInitialized()) {
+    Py_Initialize();
+#if PY_VERSION_HEX < 0x03070000
+    PyEval_InitThreads();
+#endif
+    /** release the GIL, each call acquires it with PyGILState_Ensure() */
+    py_main_state = PyEval_SaveThread();
+  }
+  g_mutex_unlock (&py_init_lock);
   g_assert(Py_IsInitialized());
 
+  PyGILState_STATE gstate = PyGILState_Ensure();
+
   _import_array();  /** for numpy */
 
   /**
@@ -98,6 +117,19 @@ PYCore::PYCore (const char* _script_path, const char* _custom)
   g_assert(shape_cls);
   Py_XDECREF(api_module);
 
+#if PY_VERSION_HEX < 0x03000000
+  invoke_name = PyString_InternFromString("invoke");
+  invoke_batch_name = PyString_InternFromString("invoke_batch");
+#else
+  invoke_name = PyUnicode_InternFromString("invoke");
+  invoke_batch_name = PyUnicode_InternFromString("invoke_batch");
+#endif
+  input_list = PyList_New(0);
+  g_assert(invoke_name && invoke_batch_name && input_list);
+  has_invoke_batch = false;
+
+  PyGILState_Release(gstate);
+
   gst_tensors_info_init (&inputTensorMeta);
   gst_tensors_info_init (&outputTensorMeta);
 
@@ -118,13 +150,26 @@ PYCore::~PYCore ()
   gst_tensors_info_free (&inputTensorMeta);
   gst_tensors_info_free (&outputTensorMeta);
 
+  PyGILState_STATE gstate = PyGILState_Ensure();
+
   if (core_obj)
     Py_XDECREF(core_obj);
   if (shape_cls)
     Py_XDECREF(shape_cls);
+  Py_XDECREF(invoke_name);
+  Py_XDECREF(invoke_batch_name);
+  Py_XDECREF(input_list);
 
   PyErr_Clear();
-  Py_Finalize();
+  PyGILState_Release(gstate);
+
+  g_mutex_lock (&py_init_lock);
+  if (--py_init_count == 0 && py_main_state) {
+    PyEval_RestoreThread(py_main_state);
+    py_main_state = NULL;
+    Py_Finalize();
+  }
+  g_mutex_unlock (&py_init_lock);
 
   dlclose(handle);
   g_mutex_clear (&py_mutex);
@@ -137,10 +182,16 @@ PYCore::~PYCore ()
 int
 PYCore::init (const GstTensorFilterProperties * prop)
 {
+  int res;
+
   gst_tensors_info_copy (&inputTensorMeta, &prop->input_meta);
   gst_tensors_info_copy (&outputTensorMeta, &prop->output_meta);
 
-  return loadScript ();
+  PyGILState_STATE gstate = Py_LOCK();
+  res = loadScript ();
+  Py_UNLOCK(gstate);
+
+  return res;
 }
 
 /**
@@ -202,6 +253,9 @@ PYCore::loadScript ()
           callback_type = CB_GETDIM;
         else
           callback_type = CB_END;
+
+        /** optional method to process the frames in a batch at once */
+        has_invoke_batch = PyObject_HasAttrString(core_obj, (char*) "invoke_batch");
       } else {
         Py_ERRMSG ("Fail to create an instance 'CustomFilter'\n");
         return -3;
@@ -293,18 +347,22 @@ PYCore::getInputTensorDim (GstTensorsInfo * info)
 
   g_assert (info);
 
-  Py_LOCK();
+  PyGILState_STATE gstate = Py_LOCK();
 
   PyObject *result = PyObject_CallMethod(core_obj, (char*) "getInputDim", NULL);
   if (result) {
     res = parseOutputTensors(result, info);
+    if (res == 0) {
+      gst_tensors_info_free (&inputTensorMeta);
+      gst_tensors_info_copy (&inputTensorMeta, info);
+    }
     Py_XDECREF(result);
   } else {
     Py_ERRMSG("Fail to call 'getInputDim'");
     res = -1;
   }
 
-  Py_UNLOCK();
+  Py_UNLOCK(gstate);
 
   return res;
 }
@@ -322,18 +380,22 @@ PYCore::getOutputTensorDim (GstTensorsInfo * info)
 
   g_assert (info);
 
-  Py_LOCK();
+  PyGILState_STATE gstate = Py_LOCK();
 
   PyObject *result = PyObject_CallMethod(core_obj, (char*) "getOutputDim", NULL);
   if (result) {
     res = parseOutputTensors(result, info);
+    if (res == 0) {
+      gst_tensors_info_free (&outputTensorMeta);
+      gst_tensors_info_copy (&outputTensorMeta, info);
+    }
     Py_XDECREF(result);
   } else {
     Py_ERRMSG("Fail to call 'getOutputDim'");
     res = -1;
   }
 
-  Py_UNLOCK();
+  Py_UNLOCK(gstate);
 
   return res;
 }
@@ -353,13 +415,15 @@ PYCore::setInputTensorDim (const GstTensorsInfo * in_info, GstTensorsInfo * out_
   g_assert (in_info);
   g_assert (out_info);
 
-  Py_LOCK();
+  PyGILState_STATE gstate = Py_LOCK();
 
   /** to Python list object */
   PyObject *param = PyList_New(0);
   g_assert (param);
 
-  inputTensorMeta.num_tensors = in_info->num_tensors;
+  /** the shape of input arrays is given from the input tensor info */
+  gst_tensors_info_free (&inputTensorMeta);
+  gst_tensors_info_copy (&inputTensorMeta, in_info);
   for (int i = 0; i < in_info->num_tensors; i++) {
     PyObject *shape = PyTensorShape_New (&in_info->info[i]);
     assert (shape);
@@ -379,15 +443,17 @@ PYCore::setInputTensorDim (const GstTensorsInfo * in_info, GstTensorsInfo * out_
 
   if (result) {
     res = parseOutputTensors(result, out_info);
-    if (res == 0)
-      outputTensorMeta.num_tensors = out_info->num_tensors;
+    if (res == 0) {
+      gst_tensors_info_free (&outputTensorMeta);
+      gst_tensors_info_copy (&outputTensorMeta, out_info);
+    }
     Py_XDECREF(result);
   } else {
     Py_ERRMSG("Fail to call 'setInputDim'");
     res = -1;
   }
 
-  Py_UNLOCK();
+  Py_UNLOCK(gstate);
 
   return res;
 }
@@ -458,6 +524,202 @@ PYCore::parseOutputTensors(PyObject* result, GstTensorsInfo * info)
   return 0;
 }
 
+/**
+ * @brief	get the shape of numpy array for the tensor
+ * @param info : the tensor info
+ * @param mem : the tensor memory
+ * @param[out] dims : the shape of numpy array (in reverse order of tensor dimension)
+ * @note	The 1-D array is used if the size of memory is not matched with the tensor info.
+ * @return the number of dimensions of numpy array
+ */
+int
+PYCore::getArrayShape (const GstTensorInfo * info, const GstTensorMemory * mem,
+    npy_intp * dims)
+{
+  gsize element_size = gst_tensor_get_element_size (mem->type);
+
+  if (info->type == mem->type &&
+      gst_tensor_get_element_count (info->dimension) * element_size == mem->size) {
+    for (int i = 0; i < NNS_TENSOR_RANK_LIMIT; i++)
+      dims[i] = (npy_intp) info->dimension[NNS_TENSOR_RANK_LIMIT - i - 1];
+    return NNS_TENSOR_RANK_LIMIT;
+  }
+
+  dims[0] = (npy_intp) (mem->size / element_size);
+  return 1;
+}
+
+/**
+ * @brief	update the numpy arrays of input list for this frame
+ * @param[in] input : The array of input tensors
+ * @note	The arrays are created once and only the data pointers are swapped for each frame.
+ *        An array still referred by the script is replaced with a new one.
+ * @return 0 if OK. non-zero if error.
+ */
+int
+PYCore::setInputArrays (const GstTensorMemory * input)
+{
+  Py_ssize_t num = PyList_GET_SIZE(input_list);
+
+  for (int i = 0; i < inputTensorMeta.num_tensors; i++) {
+    PyArrayObject *array = NULL;
+    NPY_TYPES type = getNumpyType(input[i].type);
+    npy_intp input_dims[NNS_TENSOR_RANK_LIMIT];
+    int ndim = getArrayShape (&inputTensorMeta.info[i], &input[i], input_dims);
+
+    if (i < num) {
+      array = (PyArrayObject*) PyList_GET_ITEM(input_list, i);
+      /** do not touch the array if the script (or an output) still refers it */
+      if (Py_REFCNT(array) > 1 || PyArray_TYPE(array) != type ||
+          PyArray_NDIM(array) != ndim ||
+          memcmp (PyArray_DIMS(array), input_dims, sizeof (npy_intp) * ndim) != 0)
+        array = NULL;
+    }
+
+    if (array) {
+      ((PyArrayObject_fields*) array)->data = (char*) input[i].data;
+      continue;
+    }
+
+    /** create a Numpy array wrapper (n-D view, in reverse order of tensor dimension) */
+    PyObject *input_array = PyArray_SimpleNewFromData(
+        ndim, input_dims, type, input[i].data);
+    if (!input_array) {
+      Py_ERRMSG("Fail to create an input array");
+      return -1;
+    }
+
+    if (i < num) {
+      /** steals the reference and releases the old array */
+      PyList_SetItem(input_list, i, input_array);
+    } else {
+      PyList_Append(input_list, input_array);
+      Py_XDECREF(input_array);
+      num++;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * @brief	get the number of frames to call 'invoke_batch'
+ * @param[in] input : The array of input tensors
+ * @note	The outermost dimension of input tensors (e.g., the frames from tensor_aggregator) is the batch.
+ * @return the number of frames. 1 if the script cannot process a batch.
+ */
+guint
+PYCore::getBatchSize (const GstTensorMemory * input)
+{
+  guint batch;
+
+  if (!has_invoke_batch || inputTensorMeta.num_tensors == 0)
+    return 1;
+
+  batch = inputTensorMeta.info[0].dimension[NNS_TENSOR_RANK_LIMIT - 1];
+  for (int i = 0; i < inputTensorMeta.num_tensors; i++) {
+    const GstTensorInfo *info = &inputTensorMeta.info[i];
+
+    if (info->dimension[NNS_TENSOR_RANK_LIMIT - 1] != batch ||
+        gst_tensor_info_get_size (info) != input[i].size)
+      return 1;
+  }
+
+  return batch;
+}
+
+/**
+ * @brief	call 'invoke_batch' of the script with the frames in input tensors
+ * @param[in] input : The array of input tensors
+ * @param[in] batch : The number of frames
+ * @note	'invoke_batch' receives the list of frames (each frame is the list of input arrays),
+ *        and returns the list of frames (each frame is the list of output arrays).
+ *        The output arrays are concatenated in order of frames.
+ * @return the list of output arrays (new reference). NULL if error.
+ */
+PyObject*
+PYCore::invokeBatch (const GstTensorMemory * input, guint batch)
+{
+  PyObject *frames = PyList_New(batch);
+  g_assert(frames);
+
+  for (guint k = 0; k < batch; k++) {
+    PyObject *frame = PyList_New(inputTensorMeta.num_tensors);
+    g_assert(frame);
+
+    for (int i = 0; i < inputTensorMeta.num_tensors; i++) {
+      npy_intp dims[NNS_TENSOR_RANK_LIMIT];
+      gsize frame_size = input[i].size / batch;
+
+      for (int d = 0; d < NNS_TENSOR_RANK_LIMIT; d++)
+        dims[d] = (npy_intp) inputTensorMeta.info[i].dimension[NNS_TENSOR_RANK_LIMIT - d - 1];
+      dims[0] = 1;
+
+      PyObject *array = PyArray_SimpleNewFromData(NNS_TENSOR_RANK_LIMIT, dims,
+          getNumpyType(input[i].type), (char*) input[i].data + k * frame_size);
+      g_assert(array);
+      PyList_SET_ITEM(frame, i, array); /** steals the reference */
+    }
+
+    PyList_SET_ITEM(frames, k, frame); /** steals the reference */
+  }
+
+  PyObject *result = PyObject_CallMethodObjArgs(core_obj, invoke_batch_name, frames, NULL);
+  Py_XDECREF(frames);
+
+  if (!result) {
+    Py_ERRMSG("Fail to call 'invoke_batch'");
+    return NULL;
+  }
+
+  if (!PyList_Check(result) || PyList_Size(result) != (Py_ssize_t) batch) {
+    g_critical ("'invoke_batch' should return the list of %u frames\n", batch);
+    Py_XDECREF(result);
+    return NULL;
+  }
+
+  PyObject *outputs = PyList_New(outputTensorMeta.num_tensors);
+  g_assert(outputs);
+
+  for (int i = 0; i < outputTensorMeta.num_tensors; i++) {
+    PyObject *seq = PyList_New(batch);
+    g_assert(seq);
+
+    for (guint k = 0; k < batch; k++) {
+      PyObject *frame = PyList_GetItem(result, (Py_ssize_t) k);
+      PyObject *array = NULL;
+
+      if (PyList_Check(frame) && PyList_Size(frame) == outputTensorMeta.num_tensors)
+        array = PyList_GetItem(frame, (Py_ssize_t) i);
+
+      if (!array || !PyArray_Check(array)) {
+        g_critical ("Output tensor of frame %u is not valid\n", k);
+        Py_XDECREF(seq);
+        Py_XDECREF(outputs);
+        Py_XDECREF(result);
+        return NULL;
+      }
+
+      PyList_SET_ITEM(seq, k, PyArray_Ravel((PyArrayObject*) array, NPY_CORDER));
+    }
+
+    PyObject *merged = PyArray_Concatenate(seq, 0);
+    Py_XDECREF(seq);
+
+    if (!merged) {
+      Py_ERRMSG("Fail to concatenate the output tensors");
+      Py_XDECREF(outputs);
+      Py_XDECREF(result);
+      return NULL;
+    }
+
+    PyList_SET_ITEM(outputs, i, merged);
+  }
+
+  Py_XDECREF(result);
+  return outputs;
+}
+
 /**
  * @brief	run the script with the input.
  * @param[in] input : The array of input tensors
@@ -478,21 +740,28 @@ PYCore::run (const GstTensorMemory * input, GstTensorMemory * output)
   g_assert(input);
   g_assert(output);
 
-  Py_LOCK();
+  PyGILState_STATE gstate = Py_LOCK();
 
-  PyObject *param = PyList_New(0);
-  for (int i = 0; i < inputTensorMeta.num_tensors; i++) {
-    /** create a Numpy array wrapper (1-D) for NNS tensor data */
-    npy_intp input_dims[] = {(npy_intp) input[i].size};
-    PyObject *input_array = PyArray_SimpleNewFromData(
-        1, input_dims, getNumpyType(input[i].type), input[i].data);
-    PyList_Append(param, input_array);
+  PyObject *result;
+  guint batch = getBatchSize (input);
+
+  if (batch > 1) {
+    result = invokeBatch (input, batch);
+  } else {
+    if (setInputArrays (input)) {
+      Py_UNLOCK(gstate);
+      return -1;
+    }
+
+    result = PyObject_CallMethodObjArgs(core_obj, invoke_name, input_list, NULL);
+    if (!result)
+      Py_ERRMSG("Fail to call 'invoke'");
   }
 
-  PyObject *result = PyObject_CallMethod(core_obj, (char*) "invoke", (char*) "(O)", param);
   if (result) {
     g_assert(PyList_Size(result) == outputTensorMeta.num_tensors);
 
+    std::lock_guard <std::mutex> lock (outputSlotsLock);
     for (int i = 0; i < outputTensorMeta.num_tensors; i++) {
       PyArrayObject* output_array = (PyArrayObject*) PyList_GetItem(result, (Py_ssize_t) i);
       /** type/size checking */
@@ -501,7 +770,18 @@ PYCore::run (const GstTensorMemory * input, GstTensorMemory * output)
         /** obtain the pointer to the buffer for the output array */
         output[i].data = PyArray_DATA(output_array);
         Py_XINCREF(output_array);
-        outputArrayMap.insert (std::make_pair (output[i].data, output_array));
+
+        /** keep the array in a free slot, until the data is destroyed */
+        py_output_slot_s slot = { output[i].data, output_array };
+        auto it = outputSlots.begin ();
+        for (; it != outputSlots.end (); ++it) {
+          if (it->data == NULL)
+            break;
+        }
+        if (it != outputSlots.end ())
+          *it = slot;
+        else
+          outputSlots.push_back (slot);
       } else {
         g_critical ("Output tensor type/size is not matched\n");
         res = -2;
@@ -511,18 +791,10 @@ PYCore::run (const GstTensorMemory * input, GstTensorMemory * output)
 
     Py_XDECREF(result);
   } else {
-    Py_ERRMSG("Fail to call 'invoke'");
     res = -1;
   }
 
-  /** dereference input param */
-  for (int i = 0; i < inputTensorMeta.num_tensors; i++) {
-    PyObject *input_array = PyList_GetItem(param, (Py_ssize_t) i);
-    Py_XDECREF (input_array);
-  }
-  Py_XDECREF (param);
-
-  Py_UNLOCK();
+  Py_UNLOCK(gstate);
 
 #if (DBG)
   gint64 stop_time = g_get_real_time ();
@@ -714,11 +986,25 @@ py_core_run (void * py, const GstTensorMemory * input, GstTensorMemory * output)
 void
 py_core_destroyNotify (void * data)
 {
-  std::map <void*, PyArrayObject*>::iterator it;
-  it = PYCore::outputArrayMap.find(data);
-  if (it != PYCore::outputArrayMap.end()){
-    Py_XDECREF(it->second);
-    PYCore::outputArrayMap.erase (it);
+  PyArrayObject *array = NULL;
+
+  {
+    std::lock_guard <std::mutex> lock (PYCore::outputSlotsLock);
+    for (auto & slot : PYCore::outputSlots) {
+      if (slot.data == data) {
+        array = slot.array;
+        slot.data = NULL;
+        slot.array = NULL;
+        break;
+      }
+    }
+  }
+
+  if (array) {
+    /** this is called from the thread destroying the buffer */
+    PyGILState_STATE gstate = PyGILState_Ensure();
+    Py_XDECREF(array);
+    PyGILState_Release(gstate);
   } else
     g_critical("Cannot find output data: 0x%lx", (unsigned long) data);
 }
@@ -48,7 +48,16 @@ typedef enum _cb_type
 
 #ifdef __cplusplus
 #include <vector>
-#include <map>
+#include <mutex>
+
+/**
+ * @brief	The output array held until tensor_filter destroys the data
+ */
+typedef struct
+{
+  void *data; /**< The data of output array (NULL if the slot is free) */
+  PyArrayObject *array; /**< The output array returned by the script */
+} py_output_slot_s;
 
 /**
  * @brief	Python embedding core structure
@@ -74,10 +83,10 @@ public:
 
   /** @brief Return callback type */
   cb_type getCbType () { return callback_type; }
-  /** @brief Lock python-related actions */
-  void Py_LOCK() { g_mutex_lock (&py_mutex); }
-  /** @brief Unlock python-related actions */
-  void Py_UNLOCK() { g_mutex_unlock (&py_mutex); }
+  /** @brief Lock python-related actions of this instance and acquire the GIL */
+  PyGILState_STATE Py_LOCK() { g_mutex_lock (&py_mutex); return PyGILState_Ensure (); }
+  /** @brief Release the GIL and unlock python-related actions of this instance */
+  void Py_UNLOCK(PyGILState_STATE state) { PyGILState_Release (state); g_mutex_unlock (&py_mutex); }
 
   PyObject* PyTensorShape_New (const GstTensorInfo *info);
 
@@ -87,9 +96,16 @@ public:
   tensor_type getTensorType (NPY_TYPES npyType);
   NPY_TYPES getNumpyType (tensor_type tType);
 
-  static std::map <void*, PyArrayObject*> outputArrayMap;
+  static std::vector <py_output_slot_s> outputSlots;
+  static std::mutex outputSlotsLock;
 private:
 
+  int setInputArrays (const GstTensorMemory * input);
+  int getArrayShape (const GstTensorInfo * info, const GstTensorMemory * mem,
+      npy_intp * dims);
+  guint getBatchSize (const GstTensorMemory * input);
+  PyObject* invokeBatch (const GstTensorMemory * input, guint batch);
+
   const std::string script_path;  /**< from model_path property */
   const std::string module_args;  /**< from custom property */
 
@@ -99,6 +115,10 @@ private:
 
   PyObject* core_obj;
   PyObject* shape_cls;
+  PyObject* invoke_name; /**< The method name 'invoke' */
+  PyObject* invoke_batch_name; /**< The method name 'invoke_batch' */
+  bool has_invoke_batch; /**< True if the script defines 'invoke_batch' */
+  PyObject* input_list; /**< The list of input arrays reused for every frame */
   GMutex py_mutex;
 
   GstTensorsInfo inputTensorMeta;  /**< The tensor info of input tensors */
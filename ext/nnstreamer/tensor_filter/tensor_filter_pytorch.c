@@ -166,13 +166,24 @@ torch_getOutputDim (const GstTensorFilterProperties * prop,
   return torch_core_getOutputDim (torch->torch_private_data, info);
 }
 
+/**
+ * @brief The optional callback for GstTensorFilterFramework
+ * @param[in] data The data element.
+ */
+static void
+torch_destroyNotify (void *data)
+{
+  torch_core_destroyNotify (data);
+}
+
 static gchar filter_subplugin_pytorch[] = "pytorch";
 
 static GstTensorFilterFramework NNS_support_pytorch = {
   .name = filter_subplugin_pytorch,
   .allow_in_place = FALSE,
-  .allocate_in_invoke = FALSE,
+  .allocate_in_invoke = TRUE,
   .invoke_NN = torch_invoke,
+  .destroyNotify = torch_destroyNotify,
   .getInputDimension = torch_getInputDim,
   .getOutputDimension = torch_getOutputDim,
   .open = torch_open,
@@ -34,6 +34,9 @@
 #define DBG FALSE
 #endif
 
+std::multimap < void *, at::Tensor > TorchCore::outputTensorMap;
+std::mutex TorchCore::outputTensorLock;
+
 /**
  * @brief	TorchCore creator
  * @param	_model_path	: the logical path to '{model_name}.pth' file
@@ -44,6 +47,9 @@ TorchCore::TorchCore (const char *_model_path)
 {
   model_path = _model_path;
   configured = false;
+  num_threads = 0;
+  interop_threads = 0;
+  optimize = false;
 
   gst_tensors_info_init (&inputTensorMeta);
   gst_tensors_info_init (&outputTensorMeta);
@@ -73,10 +79,125 @@ TorchCore::init (const GstTensorFilterProperties * prop,
   gst_tensors_info_copy (&inputTensorMeta, &prop->input_meta);
   gst_tensors_info_copy (&outputTensorMeta, &prop->output_meta);
 
+  parseCustomOption (prop->custom_properties);
+
+  if (setThreads ()) {
+    g_critical ("Failed to set the number of threads\n");
+    return -1;
+  }
+
   if (loadModel ()) {
     g_critical ("Failed to load model\n");
     return -1;
   }
+
+  if (optimize && optimizeModel ()) {
+    g_critical ("Failed to optimize model\n");
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * @brief	parse the custom option of tensor_filter
+ * @param	custom : the custom property (e.g., custom=num_threads:4,interop_threads:1,optimize:true)
+ */
+void
+TorchCore::parseCustomOption (const char *custom)
+{
+  gchar **strv;
+
+  if (!custom)
+    return;
+
+  strv = g_strsplit (custom, ",", -1);
+  for (guint i = 0; i < g_strv_length (strv); i++) {
+    gchar **pair = g_strsplit (g_strstrip (strv[i]), ":", 2);
+
+    if (g_strv_length (pair) == 2) {
+      const gchar *key = g_strstrip (pair[0]);
+      const gchar *value = g_strstrip (pair[1]);
+
+      if (!g_ascii_strcasecmp (key, "num_threads")) {
+        num_threads = (int) g_ascii_strtoll (value, NULL, 10);
+      } else if (!g_ascii_strcasecmp (key, "interop_threads")) {
+        interop_threads = (int) g_ascii_strtoll (value, NULL, 10);
+      } else if (!g_ascii_strcasecmp (key, "optimize")) {
+        optimize = !g_ascii_strcasecmp (value, "true");
+      }
+    }
+
+    g_strfreev (pair);
+  }
+  g_strfreev (strv);
+}
+
+/**
+ * @brief	set the number of threads of the intra-op and inter-op pools
+ * @note	The thread pools are shared in the process, the latest value is applied.
+ *        The inter-op pool cannot be changed once it is started.
+ * @return 0 if OK. non-zero if error.
+ */
+int
+TorchCore::setThreads ()
+{
+  if (num_threads > 0) {
+    at::set_num_threads (num_threads);
+  }
+
+  if (interop_threads > 0) {
+    try {
+      at::set_num_interop_threads (interop_threads);
+    } catch (const std::exception & e) {
+      g_warning ("Cannot set the number of inter-op threads: %s", e.what ());
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * @brief	run the model once with empty inputs to optimize the graph
+ * @note	The graph executor specializes and optimizes the graph at the first run.
+ *        Doing it at load time removes the delay from the first frame.
+ * @return 0 if OK. non-zero if error.
+ */
+int
+TorchCore::optimizeModel ()
+{
+  std::vector < torch::jit::IValue > input_feeds;
+  torch::autograd::AutoGradMode guard (false);
+
+  for (uint i = 0; i < inputTensorMeta.num_tensors; ++i) {
+    std::vector < int64_t > input_shape;
+    torch::Dtype type;
+
+    input_shape.assign (&inputTensorMeta.info[i].dimension[0],
+        &inputTensorMeta.info[i].dimension[0] + NNS_TENSOR_RANK_LIMIT);
+    std::reverse (input_shape.begin (), input_shape.end ());
+
+    if (!getTensorTypeToTorch (inputTensorMeta.info[i].type, &type)) {
+      g_critical ("This data type is not valid: %d",
+          inputTensorMeta.info[i].type);
+      return -1;
+    }
+
+    at::Tensor tensor =
+        torch::zeros (input_shape, torch::TensorOptions ().dtype (type));
+    if (use_gpu) {
+      tensor = tensor.to (at::kCUDA);
+    }
+
+    input_feeds.emplace_back (tensor);
+  }
+
+  try {
+    model->forward (input_feeds);
+  } catch (const std::exception & e) {
+    g_critical ("Failed to run the model: %s", e.what ());
+    return -2;
+  }
+
   return 0;
 }
 
@@ -282,20 +403,23 @@ TorchCore::getOutputTensorDim (GstTensorsInfo * info)
  * @brief	process the IValue after forward and extract data from ivalue.
  * @param[in] value IValue containing the output in tensor form
  * @param[out]  output Output tensor memory
+ * @param[in] input The array of input tensors
+ * @note The output tensor is passed to tensor_filter without copy, its reference is dropped in torch_core_destroyNotify.
  * @return 0 if OK. non-zero if error.
  *         -1 if output tensor validation fails.
  */
 int
-TorchCore::processIValue (torch::jit::IValue value, GstTensorMemory * output)
+TorchCore::processIValue (torch::jit::IValue value, GstTensorMemory * output,
+    const GstTensorMemory * input)
 {
   g_assert (value.isTensor ());
   at::Tensor output_tensor = value.toTensor ();
 
   /** bring from gpu to cpu */
   if (use_gpu) {
-    output_tensor.to (at::kCPU);
+    output_tensor = output_tensor.to (at::kCPU);
   }
-  /** make the memory contiguous for direct access */
+  /** make the memory contiguous for direct access (no copy if already contiguous) */
   output_tensor = output_tensor.contiguous ();
 
   output->type = getTensorTypeFromTorch (output_tensor.scalar_type ());
@@ -306,9 +430,26 @@ TorchCore::processIValue (torch::jit::IValue value, GstTensorMemory * output)
     return -1;
   }
 
-  /** @todo avoid this memcpy */
-  std::memcpy (output->data, output_tensor.data_ptr (),
-      output_tensor.nbytes ());
+  /**
+   * The input memory is released after invoke.
+   * Copy the output only if it shares the memory with the input tensors.
+   */
+  const char *out_data = (const char *) output_tensor.data_ptr ();
+  for (uint i = 0; i < inputTensorMeta.num_tensors; ++i) {
+    const char *in_data = (const char *) input[i].data;
+
+    if (out_data >= in_data && out_data < in_data + input[i].size) {
+      output_tensor = output_tensor.clone ();
+      break;
+    }
+  }
+
+  g_assert (output_tensor.nbytes () == output->size);
+  output->data = output_tensor.data_ptr ();
+
+  /** keep the reference of output tensor until the data is destroyed */
+  std::lock_guard < std::mutex > lock (outputTensorLock);
+  outputTensorMap.insert (std::make_pair (output->data, output_tensor));
   return 0;
 }
 
@@ -354,11 +495,15 @@ TorchCore::invoke (const GstTensorMemory * input, GstTensorMemory * output)
     input_feeds.emplace_back (tensor);
   }
 
-  output_value = model->forward (input_feeds);
+  {
+    /** autograd is not required for inference */
+    torch::autograd::AutoGradMode guard (false);
+    output_value = model->forward (input_feeds);
+  }
 
   if (output_value.isTensor ()) {
     g_assert (outputTensorMeta.num_tensors == 1);
-    if (processIValue (output_value, &output[0])) {
+    if (processIValue (output_value, &output[0], input)) {
       g_critical ("Output Tensor Information is not valid");
       return -2;
     }
@@ -368,10 +513,17 @@ TorchCore::invoke (const GstTensorMemory * input, GstTensorMemory * output)
     g_assert (outputTensorMeta.num_tensors == output_list.size ());
     int idx = 0;
   for (auto & ivalue_element:output_list) {
-      if (processIValue (ivalue_element, &output[idx++])) {
+      if (processIValue (ivalue_element, &output[idx], input)) {
         g_critical ("Output Tensor Information is not valid");
+
+        /** drop the references of the outputs already kept in the map */
+        for (int i = 0; i < idx; ++i) {
+          torch_core_destroyNotify (output[i].data);
+          output[i].data = NULL;
+        }
         return -2;
       }
+      idx++;
     }
   } else {
     g_critical ("Output is not a tensor.");
@@ -499,3 +651,18 @@ torch_core_invoke (void *torch, const GstTensorMemory * input,
   TorchCore *c = (TorchCore *) torch;
   return c->invoke (input, output);
 }
+
+/**
+ * @brief	the destroy notify method for pytorch. it will drop the reference of output tensor
+ * @param[in] data : the data element destroyed at the pipeline
+ */
+void
+torch_core_destroyNotify (void *data)
+{
+  std::lock_guard < std::mutex > lock (TorchCore::outputTensorLock);
+  auto it = TorchCore::outputTensorMap.find (data);
+
+  if (it != TorchCore::outputTensorMap.end ()) {
+    TorchCore::outputTensorMap.erase (it);
+  }
+}
@@ -29,7 +29,12 @@
 #include "nnstreamer_plugin_api_filter.h"
 
 #ifdef __cplusplus
+#include <map>
+#include <mutex>
+
 #include <torch/script.h>
+#include <torch/csrc/autograd/grad_mode.h>
+#include <ATen/Parallel.h>
 
 /**
  * @brief	ring cache structure
@@ -48,10 +53,16 @@ public:
   int getOutputTensorDim (GstTensorsInfo * info);
   int invoke (const GstTensorMemory * input, GstTensorMemory * output);
 
+  static std::multimap < void *, at::Tensor > outputTensorMap;
+  static std::mutex outputTensorLock;
+
 private:
 
   const char *model_path;
   bool use_gpu;
+  int num_threads; /**< The number of intra-op threads (0 to use the default) */
+  int interop_threads; /**< The number of inter-op threads (0 to use the default) */
+  bool optimize; /**< Run the model once at load to optimize the graph before the first frame */
 
   GstTensorsInfo inputTensorMeta;  /**< The tensor info of input tensors */
   GstTensorsInfo outputTensorMeta;  /**< The tensor info of output tensors */
@@ -63,7 +74,11 @@ private:
   bool getTensorTypeToTorch (tensor_type tensorType, torch::Dtype * torchType);
   int validateOutputTensor (at::Tensor output);
   int fillTensorDim (torch::autograd::Variable tensor_meta, tensor_dim dim);
-  int processIValue (torch::jit::IValue value, GstTensorMemory * output);
+  int processIValue (torch::jit::IValue value, GstTensorMemory * output,
+      const GstTensorMemory * input);
+  void parseCustomOption (const char *custom);
+  int setThreads ();
+  int optimizeModel ();
 };
 
 /**
@@ -82,6 +97,7 @@ extern "C"
   int torch_core_getOutputDim (void *torch, GstTensorsInfo * info);
   int torch_core_invoke (void *torch, const GstTensorMemory * input,
       GstTensorMemory * output);
+  void torch_core_destroyNotify (void *data);
 
 #ifdef __cplusplus
 }
@@ -45,6 +45,9 @@ std::map <void*, TF_Tensor*> TFCore::outputTensorMap;
 TFCore::TFCore (const char *_model_path)
 {
   model_path = _model_path;
+  graph = nullptr;
+  session = nullptr;
+  run_status = TF_NewStatus ();
 
   gst_tensors_info_init (&inputTensorMeta);
   gst_tensors_info_init (&outputTensorMeta);
@@ -71,6 +74,7 @@ TFCore::~TFCore ()
       TF_GetCode (status), TF_Message (status));
   }
   TF_DeleteStatus (status);
+  TF_DeleteStatus (run_status);
 
   gst_tensors_info_free (&inputTensorMeta);
   gst_tensors_info_free (&outputTensorMeta);
@@ -86,6 +90,11 @@ TFCore::~TFCore ()
 int
 TFCore::init (const GstTensorFilterProperties * prop)
 {
+  if (setSessionConfig (prop->custom_properties)) {
+    g_critical ("Failed to parse the session options");
+    return -1;
+  }
+
   if (loadModel ()) {
     g_critical ("Failed to load model");
     return -1;
@@ -104,6 +113,11 @@ TFCore::init (const GstTensorFilterProperties * prop)
   gst_tensors_info_copy (&inputTensorMeta, &prop->input_meta);
   gst_tensors_info_copy (&outputTensorMeta, &prop->output_meta);
 
+  /* prepare the containers used at run, to avoid allocation for each frame */
+  input_tensors.assign (inputTensorMeta.num_tensors, nullptr);
+  output_tensors.assign (outputTensorMeta.num_tensors, nullptr);
+  input_encoded.resize (inputTensorMeta.num_tensors);
+
   return 0;
 }
 
@@ -117,6 +131,158 @@ TFCore::getModelPath ()
   return model_path;
 }
 
+/**
+ * @brief	append a varint-encoded value to the serialized protobuf message
+ */
+static void
+AppendVarint (std::string & msg, guint64 value)
+{
+  while (value >= 0x80) {
+    msg.push_back ((char) ((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  msg.push_back ((char) value);
+}
+
+/**
+ * @brief	append a varint field to the serialized protobuf message
+ */
+static void
+AppendVarintField (std::string & msg, guint field, guint64 value)
+{
+  AppendVarint (msg, (field << 3) | 0); /* wire type varint */
+  AppendVarint (msg, value);
+}
+
+/**
+ * @brief	append a length-delimited field to the serialized protobuf message
+ */
+static void
+AppendMessageField (std::string & msg, guint field, const std::string & value)
+{
+  AppendVarint (msg, (field << 3) | 2); /* wire type length-delimited */
+  AppendVarint (msg, value.size ());
+  msg.append (value);
+}
+
+/**
+ * @brief	the field numbers of tensorflow ConfigProto (tensorflow/core/protobuf/config.proto)
+ */
+#define TF_CONFIG_INTRA_OP_THREADS 2
+#define TF_CONFIG_INTER_OP_THREADS 5
+#define TF_CONFIG_PER_SESSION_THREADS 9
+#define TF_CONFIG_GRAPH_OPTIONS 10
+#define TF_GRAPH_OPTIONS_REWRITE_OPTIONS 10
+#define TF_REWRITER_LAYOUT_OPTIMIZER 1
+#define TF_REWRITER_CONSTANT_FOLDING 3
+#define TF_REWRITER_TOGGLE_ON 1
+#define TF_REWRITER_TOGGLE_OFF 2
+
+/**
+ * @brief	make the session config from the custom property
+ * @param	custom : the custom property of tensor_filter
+ * @note	Supported options (e.g., custom=intra_op_threads:2,inter_op_threads:1)
+ *        config : the path of serialized ConfigProto file (this should be the last option, the path may contain ',')
+ *        intra_op_threads : the number of threads for an operation
+ *        inter_op_threads : the number of threads to run operations in parallel
+ *        per_session_threads : true to use the thread pools of this session only
+ *        constant_folding : true or false to toggle the constant folding optimizer
+ *        layout_optimizer : true or false to toggle the layout optimizer
+ *        The other options are applied over the ConfigProto given with 'config'.
+ * @return 0 if OK. non-zero if error.
+ */
+int
+TFCore::setSessionConfig (const char * custom)
+{
+  std::string config_file;
+  std::string options;
+  std::string rewrite_options;
+  gchar **strv;
+
+  session_config.clear ();
+
+  if (!custom) {
+    return 0;
+  }
+
+  strv = g_strsplit (custom, ",", -1);
+  guint num_options = g_strv_length (strv);
+  for (guint i = 0; i < num_options; i++) {
+    gchar **pair = g_strsplit (g_strstrip (strv[i]), ":", 2);
+
+    if (g_strv_length (pair) != 2) {
+      g_strfreev (pair);
+      continue;
+    }
+
+    const gchar *key = g_strstrip (pair[0]);
+    const gchar *value = g_strstrip (pair[1]);
+    gboolean enabled = !g_ascii_strcasecmp (value, "true");
+
+    if (!g_ascii_strcasecmp (key, "config")) {
+      /* the path may contain ',', the rest of the custom property is the path */
+      std::string path (value);
+
+      for (guint j = i + 1; j < num_options; j++) {
+        path += ",";
+        path += strv[j];
+      }
+
+      gchar *stripped = g_strstrip (g_strdup (path.c_str ()));
+      config_file = stripped;
+      g_free (stripped);
+
+      g_strfreev (pair);
+      break;
+    } else if (!g_ascii_strcasecmp (key, "intra_op_threads")) {
+      AppendVarintField (options, TF_CONFIG_INTRA_OP_THREADS,
+          g_ascii_strtoull (value, NULL, 10));
+    } else if (!g_ascii_strcasecmp (key, "inter_op_threads")) {
+      AppendVarintField (options, TF_CONFIG_INTER_OP_THREADS,
+          g_ascii_strtoull (value, NULL, 10));
+    } else if (!g_ascii_strcasecmp (key, "per_session_threads")) {
+      AppendVarintField (options, TF_CONFIG_PER_SESSION_THREADS, enabled);
+    } else if (!g_ascii_strcasecmp (key, "constant_folding")) {
+      AppendVarintField (rewrite_options, TF_REWRITER_CONSTANT_FOLDING,
+          enabled ? TF_REWRITER_TOGGLE_ON : TF_REWRITER_TOGGLE_OFF);
+    } else if (!g_ascii_strcasecmp (key, "layout_optimizer")) {
+      AppendVarintField (rewrite_options, TF_REWRITER_LAYOUT_OPTIMIZER,
+          enabled ? TF_REWRITER_TOGGLE_ON : TF_REWRITER_TOGGLE_OFF);
+    }
+
+    g_strfreev (pair);
+  }
+  g_strfreev (strv);
+
+  if (!config_file.empty ()) {
+    gchar *content = nullptr;
+    gsize file_size;
+    GError *file_error = nullptr;
+
+    if (!g_file_get_contents (config_file.c_str (), &content, &file_size,
+            &file_error)) {
+      g_critical ("Error reading config file!! - %s", file_error->message);
+      g_clear_error (&file_error);
+      return -1;
+    }
+
+    session_config.assign (content, file_size);
+    g_free (content);
+  }
+
+  if (!rewrite_options.empty ()) {
+    std::string graph_options;
+
+    AppendMessageField (graph_options, TF_GRAPH_OPTIONS_REWRITE_OPTIONS,
+        rewrite_options);
+    AppendMessageField (options, TF_CONFIG_GRAPH_OPTIONS, graph_options);
+  }
+
+  /* the serialized messages are merged, the latter overrides the former */
+  session_config.append (options);
+  return 0;
+}
+
 /**
  * @brief	the definition of a deallocator method
  */
@@ -180,6 +346,18 @@ TFCore::loadModel ()
 
   g_assert (graph != nullptr);
   TF_SessionOptions* options = TF_NewSessionOptions ();
+  if (!session_config.empty ()) {
+    TF_SetConfig (options, session_config.data (), session_config.size (),
+        status);
+    if (TF_GetCode (status) != TF_OK) {
+      g_critical ("Error setting the session config!! - [Code: %d] %s",
+        TF_GetCode (status), TF_Message (status));
+      TF_DeleteSessionOptions (options);
+      TF_DeleteStatus (status);
+      TF_DeleteGraph (graph);
+      return -4;
+    }
+  }
   session = TF_NewSession (graph, options, status);
   TF_DeleteSessionOptions (options);
 
@@ -277,7 +455,8 @@ TFCore::getTensorTypeToTF (tensor_type tType)
  * @brief validate the src tensor info with graph
  * @param	tensorInfo : the tensors' info which user inserted
  * @param is_input : check is it input tensor or not to save the original shape
- * @note Compare user inserted tensor information with information from loaded graphs
+ * @note Compare user inserted tensor information with information from loaded graphs.
+ *       The operations found in the graph are saved to be used at run (the previous ones are cleared).
  * @return 0 if OK. non-zero if error.
  *        -1 if getting rank of tensor is failed from the graph.
  *        -2 if getting shape of tensor is failed from the graph.
@@ -285,6 +464,14 @@ TFCore::getTensorTypeToTF (tensor_type tType)
 int
 TFCore::validateTensor (const GstTensorsInfo * tensorInfo, int is_input)
 {
+  /* the operations and shapes are filled again if validated again */
+  if (is_input) {
+    input_ops.clear ();
+    input_tensor_info.clear ();
+  } else {
+    output_ops.clear ();
+  }
+
   for (int i = 0; i < tensorInfo->num_tensors; i++) {
     // set the name of tensor
     TF_Operation *op = TF_GraphOperationByName (graph, tensorInfo->info[i].name);
@@ -296,6 +483,12 @@ TFCore::validateTensor (const GstTensorsInfo * tensorInfo, int is_input)
 
     TF_Status *status = TF_NewStatus ();
     const TF_Output output = {op, 0};
+    if (is_input) {
+      input_ops.push_back (output);
+    } else {
+      output_ops.push_back (output);
+    }
+
     const TF_DataType type = TF_OperationOutputType (output);
     const int num_dims = TF_GraphGetTensorNumDims (graph, output, status);
     tf_tensor_info_s info_s;
@@ -398,46 +591,39 @@ TFCore::run (const GstTensorMemory * input, GstTensorMemory * output)
 #if (DBG)
   gint64 start_time = g_get_real_time ();
 #endif
-  std::vector<TF_Output> input_ops;
-  std::vector<TF_Tensor*> input_tensors;
-  std::vector<TF_Output> output_ops;
-  std::vector<TF_Tensor*> output_tensors;
-  TF_Status* status = TF_NewStatus ();
-  char *input_encoded = nullptr;
+  TF_Status *status = run_status;
 
   // create input tensor for the graph from `input`
   for (int i = 0; i < inputTensorMeta.num_tensors; i++) {
     TF_Tensor* in_tensor = nullptr;
-    TF_Output input_op = {
-      TF_GraphOperationByName (graph, inputTensorMeta.info[i].name), 0
-      };
-    g_assert (input_op.oper != nullptr);
-    input_ops.push_back (input_op);
 
     if (input_tensor_info[i].type == TF_STRING){
       size_t encoded_size = TF_StringEncodedSize (input[i].size);
       size_t total_size = 8 + encoded_size;
-      input_encoded = (char*) malloc (total_size);
-      for (int j =0; j < 8; ++j) {
-          input_encoded[j] = 0;
-      }
+      /* the buffer is reused and grows only if a larger input comes */
+      std::vector<char> &encoded = input_encoded[i];
+
+      encoded.resize (total_size);
+      std::fill_n (encoded.begin (), 8, 0);
       TF_StringEncode (
         (char *)input[i].data,
         input[i].size,
-        input_encoded+8,
+        encoded.data () + 8,
         encoded_size,
         status); // fills the rest of tensor data
       if (TF_GetCode (status) != TF_OK) {
         g_critical ("Error String Encoding!! - [Code: %d] %s",
           TF_GetCode (status), TF_Message (status));
-        TF_DeleteStatus (status);
+        for (int j = 0; j < i; j++) {
+          TF_DeleteTensor (input_tensors[j]);
+        }
         return -1;
       }
       in_tensor = TF_NewTensor (
         input_tensor_info[i].type,
         NULL,
         0,
-        input_encoded,
+        encoded.data (),
         total_size,
         &DeallocateTensor,
         nullptr);
@@ -452,20 +638,10 @@ TFCore::run (const GstTensorMemory * input, GstTensorMemory * output)
           DeallocateTensor, /* no deallocator */
           nullptr);
     }
-    input_tensors.push_back (in_tensor);
+    input_tensors[i] = in_tensor;
   }
 
-  // create output tensor for the graph from `output`
-  for (int i = 0; i < outputTensorMeta.num_tensors; i++) {
-    TF_Output output_op = {
-      TF_GraphOperationByName (graph, outputTensorMeta.info[i].name), 0
-      };
-    g_assert (output_op.oper != nullptr);
-    output_ops.push_back (output_op);
-
-    TF_Tensor* out_tensor = nullptr;
-    output_tensors.push_back (out_tensor);
-  }
+  std::fill (output_tensors.begin (), output_tensors.end (), nullptr);
 
   TF_SessionRun (session,
                 nullptr,
@@ -480,15 +656,12 @@ TFCore::run (const GstTensorMemory * input, GstTensorMemory * output)
 
   for (int i = 0; i < inputTensorMeta.num_tensors; i++) {
     TF_DeleteTensor (input_tensors[i]);
-    if (input_tensor_info[i].type == TF_STRING && input_encoded){
-      free (input_encoded);
-    }
+    input_tensors[i] = nullptr;
   }
 
   if (TF_GetCode (status) != TF_OK) {
     g_critical ("Error Running Session!! - [Code: %d] %s",
       TF_GetCode (status), TF_Message (status));
-    TF_DeleteStatus (status);
     return -2;
   }
 
@@ -496,7 +669,6 @@ TFCore::run (const GstTensorMemory * input, GstTensorMemory * output)
     output[i].data = TF_TensorData (output_tensors[i]);
     outputTensorMap.insert (std::make_pair (output[i].data, output_tensors[i]));
   }
-  TF_DeleteStatus (status);
 
 #if (DBG)
   gint64 stop_time = g_get_real_time ();
@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <vector>
 #include <map>
+#include <string>
 
 #include <tensorflow/c/c_api.h>
 
@@ -80,12 +81,22 @@ private:
 
   std::vector < tf_tensor_info_s > input_tensor_info; /* hold information for TF */
 
+  std::string session_config; /**< The serialized ConfigProto to create the session */
+
   TF_Graph *graph;
   TF_Session *session;
+  TF_Status *run_status; /**< The status object reused for every run */
+
+  std::vector < TF_Output > input_ops; /**< The input operations resolved from the graph */
+  std::vector < TF_Output > output_ops; /**< The output operations resolved from the graph */
+  std::vector < TF_Tensor * > input_tensors; /**< The container of input tensors reused for every run */
+  std::vector < TF_Tensor * > output_tensors; /**< The container of output tensors reused for every run */
+  std::vector < std::vector < char > > input_encoded; /**< The buffer pool to encode the string inputs */
 
   tensor_type getTensorTypeFromTF (TF_DataType tfType);
   TF_DataType getTensorTypeToTF (tensor_type tType);
   int validateTensor (const GstTensorsInfo * tensorInfo, int is_input);
+  int setSessionConfig (const char * custom);
 };
 
 /**
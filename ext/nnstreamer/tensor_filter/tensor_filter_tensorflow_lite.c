@@ -41,6 +41,7 @@ void fini_filter_tflite (void) __attribute__ ((destructor));
 struct _Tflite_data
 {
   void *tflite_private_data;
+  gboolean need_resize; /**< caps negotiation may have changed the input dimension of the model */
 };
 typedef struct _Tflite_data tflite_data;
 
@@ -69,6 +70,37 @@ get_nnapi_hw_type (const gchar * str)
   return (index < 0) ? NNAPI_UNKNOWN : index;
 }
 
+/**
+ * @brief Check the custom property to resize the model inputs with the negotiated dimension
+ * @param custom the custom property string of tensor_filter (e.g., "dynamic_input:true")
+ * @return TRUE if the input dimension is dynamic
+ */
+static gboolean
+tflite_is_dynamic_input (const gchar * custom)
+{
+  gchar **options;
+  gboolean dynamic = FALSE;
+  guint i;
+
+  if (!custom)
+    return FALSE;
+
+  options = g_strsplit (custom, ",", -1);
+  for (i = 0; i < g_strv_length (options); i++) {
+    gchar **option = g_strsplit (g_strstrip (options[i]), ":", 2);
+
+    if (g_strv_length (option) == 2 &&
+        g_ascii_strcasecmp (g_strstrip (option[0]), "dynamic_input") == 0) {
+      dynamic = (g_ascii_strcasecmp (g_strstrip (option[1]), "true") == 0);
+    }
+
+    g_strfreev (option);
+  }
+  g_strfreev (options);
+
+  return dynamic;
+}
+
 /**
  * @brief Load tensorflow lite modelfile
  * @param prop property of tensor_filter instance
@@ -106,7 +138,8 @@ tflite_loadModelFile (const GstTensorFilterProperties * prop,
   }
   tf = g_new0 (tflite_data, 1); /** initialize tf Fill Zero! */
   *private_data = tf;
-  tf->tflite_private_data = tflite_core_new (prop->model_file, hw);
+  tf->tflite_private_data = tflite_core_new (prop->model_file, hw,
+      tflite_is_dynamic_input (prop->custom_properties));
   if (tf->tflite_private_data) {
     if (tflite_core_init (tf->tflite_private_data)) {
       g_printerr ("failed to initialize the object: Tensorflow-lite");
@@ -148,6 +181,19 @@ tflite_invoke (const GstTensorFilterProperties * prop, void **private_data,
   tflite_data *tf;
   tf = *private_data;
   g_assert (*private_data);
+
+  if (tf->need_resize) {
+    /** caps negotiation may have tried other shapes, select the configured one */
+    retval = tflite_core_setInputDim (tf->tflite_private_data,
+        &prop->input_meta, NULL);
+    if (retval != 0) {
+      g_critical ("Failed to resize the model inputs with the negotiated dimension");
+      return retval;
+    }
+
+    tf->need_resize = FALSE;
+  }
+
   retval = tflite_core_invoke (tf->tflite_private_data, input, output);
   g_assert (retval == 0);
   return retval;
@@ -166,6 +212,11 @@ tflite_getInputDim (const GstTensorFilterProperties * prop, void **private_data,
   tflite_data *tf;
   tf = *private_data;
   g_assert (*private_data);
+
+  /** let tensor_filter configure the input dimension from caps */
+  if (tflite_core_isDynamicInput (tf->tflite_private_data))
+    return -1;
+
   return tflite_core_getInputDim (tf->tflite_private_data, info);
 }
 
@@ -182,9 +233,38 @@ tflite_getOutputDim (const GstTensorFilterProperties * prop,
   tflite_data *tf;
   tf = *private_data;
   g_assert (*private_data);
+
+  /** the output dimension depends on the input, see tflite_setInputDim */
+  if (tflite_core_isDynamicInput (tf->tflite_private_data))
+    return -1;
+
   return tflite_core_getOutputDim (tf->tflite_private_data, info);
 }
 
+/**
+ * @brief The optional callback for GstTensorFilterFramework
+ * @param prop property of tensor_filter instance
+ * @param private_data : tensorflow lite plugin's private data
+ * @param[in] in_info The dimesions and types of input tensors
+ * @param[out] out_info The dimesions and types of output tensors
+ * @note The model inputs are resized only if "dynamic_input:true" is given with the custom property.
+ */
+static int
+tflite_setInputDim (const GstTensorFilterProperties * prop,
+    void **private_data, const GstTensorsInfo * in_info,
+    GstTensorsInfo * out_info)
+{
+  tflite_data *tf;
+  tf = *private_data;
+  g_assert (*private_data);
+
+  /** resize the model inputs again with the negotiated dimension before the next invoke */
+  if (tflite_core_isDynamicInput (tf->tflite_private_data))
+    tf->need_resize = TRUE;
+
+  return tflite_core_setInputDim (tf->tflite_private_data, in_info, out_info);
+}
+
 static gchar filter_subplugin_tensorflow_lite[] = "tensorflow-lite";
 
 static GstTensorFilterFramework NNS_support_tensorflow_lite = {
@@ -194,6 +274,7 @@ static GstTensorFilterFramework NNS_support_tensorflow_lite = {
   .invoke_NN = tflite_invoke,
   .getInputDimension = tflite_getInputDim,
   .getOutputDimension = tflite_getOutputDim,
+  .setInputDimension = tflite_setInputDim,
   .open = tflite_open,
   .close = tflite_close,
 };
@@ -39,12 +39,20 @@
 /**
  * @brief	TFLiteCore creator
  * @param	_model_path	: the logical path to '{model_name}.tffile' file
+ * @param	hw	: the nnapi hw type
+ * @param	_dynamic_input	: true to resize the model inputs with the negotiated dimension
  * @note	the model of _model_path will be loaded simultaneously
  * @return	Nothing
  */
-TFLiteCore::TFLiteCore (const char * _model_path, nnapi_hw hw)
+TFLiteCore::TFLiteCore (const char * _model_path, nnapi_hw hw,
+    bool _dynamic_input)
 {
   model_path = _model_path;
+  dynamic_input = _dynamic_input;
+  interpreter = nullptr;
+#ifdef ENABLE_NNFW
+  nnfw_delegate = nullptr;
+#endif
   if(hw == NNAPI_UNKNOWN){
     use_nnapi = nnsconf_get_custom_value_bool ("tensorflowlite", "enable_nnapi", FALSE);
   } else {
@@ -113,7 +121,7 @@ TFLiteCore::loadModel ()
   gint64 start_time = g_get_real_time ();
 #endif
 
-  if (!interpreter) {
+  if (!model) {
     if (!g_file_test (model_path, G_FILE_TEST_IS_REGULAR)) {
       g_critical ("the file of model_path (%s) is not valid (not regular)\n", model_path);
       return -1;
@@ -128,50 +136,116 @@ TFLiteCore::loadModel ()
     /* If got any trouble at model, active below code. It'll be help to analyze. */
     /* model->error_reporter (); */
 
-    tflite::ops::builtin::BuiltinOpResolver resolver;
-    tflite::InterpreterBuilder (*model, resolver) (&interpreter);
-    if (!interpreter) {
-      g_critical ("Failed to construct interpreter\n");
+    std::unique_ptr <tflite::Interpreter> interp = buildInterpreter (nullptr);
+    if (!interp) {
       return -2;
     }
 
-    interpreter->UseNNAPI(use_nnapi);
+    /** the interpreter with the shape defined in the model */
+    std::vector <std::vector <int>> shapes;
+    for (int idx : interp->inputs ()) {
+      TfLiteIntArray *dims = interp->tensor (idx)->dims;
+      shapes.push_back (std::vector <int> (dims->data, dims->data + dims->size));
+    }
 
-#ifdef ENABLE_NNFW
-    if(use_nnapi){
-      nnfw_delegate.reset(new ::nnfw::tflite::NNAPIDelegate);
-      if(nnfw_delegate->BuildGraph(interpreter.get()) != kTfLiteOk){
-	g_critical("Fail to BuildGraph");
-	return -3;
-      }
+    interpreter = interp.get ();
+    interpreters[getShapeKey (shapes)] = std::move (interp);
+
+    if (buildDelegate ()) {
+      return -3;
     }
-#endif
+
     if (use_nnapi)
       g_info ("interpreter->UseNNAPI(%s)", nnapi_hw_string[accel]);
+  }
+#if (DBG)
+  gint64 stop_time = g_get_real_time ();
+  g_message ("Model is loaded: %" G_GINT64_FORMAT, (stop_time - start_time));
+#endif
+  return 0;
+}
 
-    /** set allocation type to dynamic for in/out tensors */
-    int tensor_idx;
+/**
+ * @brief	build an interpreter of the loaded model
+ * @param shapes	: the input shapes to resize the model inputs (nullptr to use the shapes defined in the model)
+ * @return the interpreter with allocated tensors. nullptr if error.
+ */
+std::unique_ptr <tflite::Interpreter>
+TFLiteCore::buildInterpreter (const std::vector <std::vector <int>> *shapes)
+{
+  std::unique_ptr <tflite::Interpreter> interp;
+  tflite::ops::builtin::BuiltinOpResolver resolver;
 
-    int tensorSize = interpreter->inputs ().size ();
-    for (int i = 0; i < tensorSize; ++i) {
-      tensor_idx = interpreter->inputs ()[i];
-      interpreter->tensor (tensor_idx)->allocation_type = kTfLiteDynamic;
-    }
+  tflite::InterpreterBuilder (*model, resolver) (&interp);
+  if (!interp) {
+    g_critical ("Failed to construct interpreter\n");
+    return nullptr;
+  }
+
+  interp->UseNNAPI (use_nnapi);
+
+  if (shapes) {
+    int tensorSize = interp->inputs ().size ();
+    g_assert (tensorSize == (int) shapes->size ());
 
-    tensorSize = interpreter->outputs ().size ();
     for (int i = 0; i < tensorSize; ++i) {
-      tensor_idx = interpreter->outputs ()[i];
-      interpreter->tensor (tensor_idx)->allocation_type = kTfLiteDynamic;
+      if (interp->ResizeInputTensor (interp->inputs ()[i],
+              (*shapes)[i]) != kTfLiteOk) {
+        g_critical ("Failed to resize the input tensor %d\n", i);
+        return nullptr;
+      }
     }
+  }
 
-    if (interpreter->AllocateTensors () != kTfLiteOk) {
-      g_critical ("Failed to allocate tensors\n");
-      return -2;
+  /** set allocation type to dynamic for in/out tensors */
+  int tensor_idx;
+
+  int tensorSize = interp->inputs ().size ();
+  for (int i = 0; i < tensorSize; ++i) {
+    tensor_idx = interp->inputs ()[i];
+    interp->tensor (tensor_idx)->allocation_type = kTfLiteDynamic;
+  }
+
+  tensorSize = interp->outputs ().size ();
+  for (int i = 0; i < tensorSize; ++i) {
+    tensor_idx = interp->outputs ()[i];
+    interp->tensor (tensor_idx)->allocation_type = kTfLiteDynamic;
+  }
+
+  if (interp->AllocateTensors () != kTfLiteOk) {
+    g_critical ("Failed to allocate tensors\n");
+    return nullptr;
+  }
+
+  return interp;
+}
+
+/**
+ * @brief	build the nnfw delegate for the current interpreter
+ * @note	the delegate is kept with the interpreter, so the graph is built only once for each input shape.
+ * @return 0 if OK. non-zero if error.
+ */
+int
+TFLiteCore::buildDelegate ()
+{
+#ifdef ENABLE_NNFW
+  if (use_nnapi) {
+    auto it = nnfw_delegates.find (interpreter);
+
+    if (it == nnfw_delegates.end ()) {
+      std::unique_ptr <nnfw::tflite::NNAPIDelegate> delegate (
+          new ::nnfw::tflite::NNAPIDelegate);
+
+      if (delegate->BuildGraph (interpreter) != kTfLiteOk) {
+        g_critical ("Fail to BuildGraph");
+        return -1;
+      }
+
+      it = nnfw_delegates.emplace (interpreter, std::move (delegate)).first;
     }
+
+    nnfw_delegate = it->second.get ();
   }
-#if (DBG)
-  gint64 stop_time = g_get_real_time ();
-  g_message ("Model is loaded: %" G_GINT64_FORMAT, (stop_time - start_time));
 #endif
   return 0;
 }
@@ -312,6 +386,134 @@ TFLiteCore::getOutputTensorDim (GstTensorsInfo * info)
   return 0;
 }
 
+/**
+ * @brief	check whether the model inputs are resized with the negotiated dimension
+ * @return true if the input dimension is dynamic.
+ */
+bool
+TFLiteCore::isDynamicInput ()
+{
+  return dynamic_input;
+}
+
+/**
+ * @brief	convert the tensors info into the input shapes of the model
+ * @param info	: the structure of input tensors info
+ * @param[out] shapes	: the input shapes in the order of tflite (reversed)
+ * @return 0 if OK. non-zero if error.
+ */
+int
+TFLiteCore::getInputShapes (const GstTensorsInfo * info,
+    std::vector <std::vector <int>> &shapes)
+{
+  auto input_idx_list = interpreter->inputs ();
+
+  if (info->num_tensors != input_idx_list.size ()) {
+    g_critical ("The number of input tensors (%u) is not matched with the model (%zu)",
+        info->num_tensors, input_idx_list.size ());
+    return -1;
+  }
+
+  shapes.clear ();
+  for (unsigned int i = 0; i < info->num_tensors; ++i) {
+    TfLiteTensor *tensor_ptr = interpreter->tensor (input_idx_list[i]);
+    int len = tensor_ptr->dims->size;
+
+    if (info->info[i].type != getTensorType (tensor_ptr->type)) {
+      g_critical ("The type of input tensor %u is not matched with the model", i);
+      return -1;
+    }
+
+    /* the rank of the model input cannot be changed */
+    for (int j = len; j < NNS_TENSOR_RANK_LIMIT; ++j) {
+      if (info->info[i].dimension[j] != 1) {
+        g_critical ("The rank of input tensor %u is larger than the model (%d)",
+            i, len);
+        return -1;
+      }
+    }
+
+    /* the order of dimension is reversed at CAPS negotiation */
+    std::vector <int> shape (len);
+    std::reverse_copy (info->info[i].dimension, info->info[i].dimension + len,
+        shape.begin ());
+    shapes.push_back (shape);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief	get the key string to look up the interpreter of the input shapes
+ * @param shapes	: the input shapes
+ * @return the key string
+ */
+std::string
+TFLiteCore::getShapeKey (const std::vector <std::vector <int>> &shapes)
+{
+  std::string key;
+
+  for (const auto &shape : shapes) {
+    for (int d : shape) {
+      key += std::to_string (d) + ":";
+    }
+    key += ",";
+  }
+
+  return key;
+}
+
+/**
+ * @brief	resize the model inputs with the given dimension.
+ * @param info	: the structure of input tensors info
+ * @note	the interpreter (and its allocated tensors) is cached for each distinct input shape,
+ *        so switching to a shape that has been used before does not allocate the tensors again.
+ * @return 0 if OK. non-zero if error.
+ */
+int
+TFLiteCore::setInputTensorDim (const GstTensorsInfo * info)
+{
+  std::vector <std::vector <int>> shapes;
+
+  if (gst_tensors_info_is_equal (&inputTensorMeta, info)) {
+    /* nothing to do */
+    return 0;
+  }
+
+  if (!dynamic_input) {
+    g_critical ("The input dimension of the model is fixed");
+    return -1;
+  }
+
+  if (getInputShapes (info, shapes)) {
+    return -1;
+  }
+
+  std::string key = getShapeKey (shapes);
+  auto it = interpreters.find (key);
+
+  if (it == interpreters.end ()) {
+    std::unique_ptr <tflite::Interpreter> interp = buildInterpreter (&shapes);
+    if (!interp) {
+      return -2;
+    }
+
+    it = interpreters.emplace (key, std::move (interp)).first;
+  }
+
+  interpreter = it->second.get ();
+
+  if (buildDelegate ()) {
+    return -3;
+  }
+
+  if (setInputTensorProp () || setOutputTensorProp ()) {
+    return -4;
+  }
+
+  return 0;
+}
+
 /**
  * @brief	run the model with the input.
  * @param[in] input : The array of input tensors
@@ -349,7 +551,7 @@ TFLiteCore::invoke (const GstTensorMemory * input, GstTensorMemory * output)
 
 #ifdef ENABLE_NNFW
   if(use_nnapi){
-    if(nnfw_delegate->Invoke(interpreter.get()) != kTfLiteOk){
+    if(nnfw_delegate->Invoke(interpreter) != kTfLiteOk){
       g_critical ("Failed to invoke");
       return -3;
     }
@@ -384,12 +586,14 @@ TFLiteCore::invoke (const GstTensorMemory * input, GstTensorMemory * output)
 /**
  * @brief	call the creator of TFLiteCore class.
  * @param	_model_path	: the logical path to '{model_name}.tffile' file
+ * @param	hw	: the nnapi hw type
+ * @param	dynamic_input	: TRUE to resize the model inputs with the negotiated dimension
  * @return	TFLiteCore class
  */
 void *
-tflite_core_new (const char * _model_path, nnapi_hw hw)
+tflite_core_new (const char * _model_path, nnapi_hw hw, int dynamic_input)
 {
-  return new TFLiteCore (_model_path, hw);
+  return new TFLiteCore (_model_path, hw, dynamic_input);
 }
 
 /**
@@ -454,6 +658,40 @@ tflite_core_getOutputDim (void * tflite, GstTensorsInfo * info)
   return c->getOutputTensorDim (info);
 }
 
+/**
+ * @brief	set the Dimension of Input Tensor of model and get the corresponding output
+ * @param	tflite	: the class object
+ * @param[in] in_info Structure for input tensor info.
+ * @param[out] out_info Structure for output tensor info. (NULL to skip)
+ * @return 0 if OK. non-zero if error.
+ */
+int
+tflite_core_setInputDim (void * tflite, const GstTensorsInfo * in_info,
+    GstTensorsInfo * out_info)
+{
+  TFLiteCore *c = (TFLiteCore *) tflite;
+  int ret;
+
+  ret = c->setInputTensorDim (in_info);
+  if (ret == 0 && out_info) {
+    ret = c->getOutputTensorDim (out_info);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief	check whether the model inputs are resized with the negotiated dimension
+ * @param	tflite	: the class object
+ * @return TRUE if the input dimension is dynamic.
+ */
+int
+tflite_core_isDynamicInput (void * tflite)
+{
+  TFLiteCore *c = (TFLiteCore *) tflite;
+  return c->isDynamicInput ();
+}
+
 /**
  * @brief	invoke the model
  * @param	tflite	: the class object
@@ -29,6 +29,9 @@
 
 #ifdef __cplusplus
 #include <iostream>
+#include <map>
+#include <string>
+#include <vector>
 
 #include <tensorflow/contrib/lite/model.h>
 #include <tensorflow/contrib/lite/kernels/register.h>
@@ -43,7 +46,7 @@
 class TFLiteCore
 {
 public:
-  TFLiteCore (const char *_model_path, nnapi_hw hw);
+  TFLiteCore (const char *_model_path, nnapi_hw hw, bool _dynamic_input);
   ~TFLiteCore ();
 
   int init ();
@@ -53,6 +56,8 @@ public:
   int setOutputTensorProp ();
   int getInputTensorDim (GstTensorsInfo * info);
   int getOutputTensorDim (GstTensorsInfo * info);
+  int setInputTensorDim (const GstTensorsInfo * info);
+  bool isDynamicInput ();
   int invoke (const GstTensorMemory * input, GstTensorMemory * output);
 
 private:
@@ -60,19 +65,28 @@ private:
   const char *model_path;
   bool use_nnapi;
   nnapi_hw accel;
+  bool dynamic_input;
 
   GstTensorsInfo inputTensorMeta;  /**< The tensor info of input tensors */
   GstTensorsInfo outputTensorMeta;  /**< The tensor info of output tensors */
 
-  std::unique_ptr <tflite::Interpreter> interpreter;
   std::unique_ptr <tflite::FlatBufferModel> model;
+  tflite::Interpreter *interpreter;  /**< The interpreter for the current input shape */
+  std::map <std::string, std::unique_ptr <tflite::Interpreter>> interpreters;  /**< The interpreters allocated for each input shape */
 
 #ifdef ENABLE_NNFW
-  std::unique_ptr <nnfw::tflite::NNAPIDelegate> nnfw_delegate;
+  nnfw::tflite::NNAPIDelegate *nnfw_delegate;  /**< The delegate of the current interpreter */
+  std::map <tflite::Interpreter *, std::unique_ptr <nnfw::tflite::NNAPIDelegate>> nnfw_delegates;  /**< The delegates built for each interpreter */
 #endif
 
   tensor_type getTensorType (TfLiteType tfType);
   int getTensorDim (int tensor_idx, tensor_dim dim);
+  int getInputShapes (const GstTensorsInfo * info,
+      std::vector <std::vector <int>> &shapes);
+  std::string getShapeKey (const std::vector <std::vector <int>> &shapes);
+  std::unique_ptr <tflite::Interpreter> buildInterpreter (
+      const std::vector <std::vector <int>> *shapes);
+  int buildDelegate ();
 };
 
 /**
@@ -92,12 +106,16 @@ extern "C"
     NULL
   };
 
-  void *tflite_core_new (const char *_model_path, nnapi_hw hw);
+  void *tflite_core_new (const char *_model_path, nnapi_hw hw,
+      int dynamic_input);
   void tflite_core_delete (void * tflite);
   int tflite_core_init (void * tflite);
   const char *tflite_core_getModelPath (void * tflite);
   int tflite_core_getInputDim (void * tflite, GstTensorsInfo * info);
   int tflite_core_getOutputDim (void * tflite, GstTensorsInfo * info);
+  int tflite_core_setInputDim (void * tflite, const GstTensorsInfo * in_info,
+      GstTensorsInfo * out_info);
+  int tflite_core_isDynamicInput (void * tflite);
   int tflite_core_invoke (void * tflite, const GstTensorMemory * input,
       GstTensorMemory * output);
 
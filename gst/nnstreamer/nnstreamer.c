@@ -57,6 +57,7 @@
 #include "tensor_repo/tensor_reposink.h"
 #include "tensor_repo/tensor_reposrc.h"
 #include "tensor_sink/tensor_sink.h"
+#include "tensor_source/tensor_src_file.h"
 #if defined(__gnu_linux__) && !defined(__ANDROID__)
 #include "tensor_source/tensor_src_iio.h"
 #endif /* __gnu_linux__ && !__ANDROID__ */
@@ -88,6 +89,7 @@ gst_nnstreamer_init (GstPlugin * plugin)
   NNSTREAMER_INIT (plugin, reposrc, REPOSRC);
   NNSTREAMER_INIT (plugin, sink, SINK);
   NNSTREAMER_INIT (plugin, split, SPLIT);
+  NNSTREAMER_INIT (plugin, src_file, SRC_FILE);
   NNSTREAMER_INIT (plugin, transform, TRANSFORM);
 #if defined(__gnu_linux__) && !defined(__ANDROID__)
   NNSTREAMER_INIT (plugin, src_iio, SRC_IIO);
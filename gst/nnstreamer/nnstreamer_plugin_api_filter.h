@@ -77,7 +77,7 @@ typedef struct _GstTensorFilterFramework
 {
   char *name; /**< Name of the neural network framework, searchable by FRAMEWORK property */
   int allow_in_place; /**< TRUE(nonzero) if InPlace transfer of input-to-output is allowed. Not supported in main, yet */
-  int allocate_in_invoke; /**< TRUE(nonzero) if invoke_NN is going to allocate outputptr by itself and return the address via outputptr. Do not change this value after cap negotiation is complete (or the stream has been started). */
+  int allocate_in_invoke; /**< TRUE(nonzero) if invoke_NN is going to allocate outputptr by itself and return the address via outputptr. The input tensors are kept until the output tensors are released, so the output may refer to the input. Do not change this value after cap negotiation is complete (or the stream has been started). */
   int run_without_model; /**< TRUE(nonzero) when the neural network framework does not need a model file. Tensor-filter will run invoke_NN without model. */
 
   int (*invoke_NN) (const GstTensorFilterProperties * prop, void **private_data,
@@ -154,6 +154,14 @@ typedef struct _GstTensorFilterFramework
        *
        * @param[in] data the data element.
        */
+
+  int (*allocateInInvoke) (void **private_data, void (**destroy) (void * data));
+      /**< Optional. Set NULL if allocate_in_invoke and destroyNotify apply to all instances of the sub-plugin. tensor_filter.c calls it once after open to decide whether invoke_NN of this instance allocates the output tensors (e.g., a sub-plugin that loads another library for each instance).
+       *
+       * @param[in/out] private_data A subplugin may save its internal private data here. The subplugin is responsible for alloc/free of this pointer.
+       * @param[out] destroy The function to release the output tensors of this instance. If it's not set, destroyNotify (or g_free() if it is NULL) will be used.
+       * @return 0 if invoke_NN of this instance allocates the output tensors. -errno if tensor_filter.c allocates them.
+       */
 } GstTensorFilterFramework;
 
 /* extern functions for subplugin management, exist in tensor_filter.c */
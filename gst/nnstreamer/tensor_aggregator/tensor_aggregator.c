@@ -63,10 +63,12 @@
 #define silent_debug_config(c,msg) do { \
   if (DBG) { \
     if (c) { \
-      gchar *dim_str; \
-      dim_str = gst_tensor_get_dimension_string ((c)->info.dimension); \
-      GST_DEBUG_OBJECT (self, msg " type=%d dim=%s rate=%d/%d", (c)->info.type, dim_str, (c)->rate_n, (c)->rate_d); \
+      gchar *dim_str, *type_str; \
+      dim_str = gst_tensors_info_get_dimensions_string (&(c)->info); \
+      type_str = gst_tensors_info_get_types_string (&(c)->info); \
+      GST_DEBUG_OBJECT (self, msg " type=%s dim=%s rate=%d/%d", type_str, dim_str, (c)->rate_n, (c)->rate_d); \
       g_free (dim_str); \
+      g_free (type_str); \
     } \
   } \
 } while (0)
@@ -84,6 +86,7 @@ enum
   PROP_FRAMES_OUT,
   PROP_FRAMES_FLUSH,
   PROP_FRAMES_DIMENSION,
+  PROP_FRAMES_DIMENSIONS,
   PROP_CONCAT,
   PROP_SILENT
 };
@@ -118,13 +121,18 @@ enum
  */
 #define DEFAULT_CONCAT TRUE
 
+/**
+ * @brief The minimum number of flushes in a memory block for overlapping windows.
+ */
+#define WINDOW_MIN_FLUSHES_IN_BLOCK 4
+
 /**
  * @brief Template for sink pad.
  */
 static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
     GST_PAD_ALWAYS,
-    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT));
+    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT "; " GST_TENSORS_CAP_DEFAULT));
 
 /**
  * @brief Template for src pad.
@@ -132,7 +140,7 @@ static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
 static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
     GST_PAD_ALWAYS,
-    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT));
+    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT "; " GST_TENSORS_CAP_DEFAULT));
 
 #define gst_tensor_aggregator_parent_class parent_class
 G_DEFINE_TYPE (GstTensorAggregator, gst_tensor_aggregator, GST_TYPE_ELEMENT);
@@ -160,6 +168,8 @@ static GstCaps *gst_tensor_aggregator_query_caps (GstTensorAggregator * self,
     GstPad * pad, GstCaps * filter);
 static gboolean gst_tensor_aggregator_parse_caps (GstTensorAggregator * self,
     const GstCaps * caps);
+static GstCaps *gst_tensor_aggregator_get_caps (GstTensorAggregator * self,
+    const GstTensorsConfig * config);
 
 /**
  * @brief Initialize the tensor_aggregator's class.
@@ -228,6 +238,18 @@ gst_tensor_aggregator_class_init (GstTensorAggregatorClass * klass)
           0, (NNS_TENSOR_RANK_LIMIT - 1), DEFAULT_FRAMES_DIMENSION,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorAggregator::frames-dims:
+   *
+   * The dimension index of frames in each tensor (other/tensors), separated by ',' (e.g., 3,1).
+   * If not given, frames-dim is used for all tensors.
+   */
+  g_object_class_install_property (object_class, PROP_FRAMES_DIMENSIONS,
+      g_param_spec_string ("frames-dims", "Dimension indices of frames",
+          "The dimension index of frames in each tensor, separated by ',' "
+          "(frames-dim is used if not given)", "",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstTensorAggregator::concat:
    *
@@ -290,9 +312,15 @@ gst_tensor_aggregator_init (GstTensorAggregator * self)
   self->frames_out = DEFAULT_FRAMES_OUT;
   self->frames_flush = DEFAULT_FRAMES_FLUSH;
   self->frames_dim = DEFAULT_FRAMES_DIMENSION;
+  self->num_frames_dims = 0;
   self->concat = DEFAULT_CONCAT;
 
   self->adapter = gst_adapter_new ();
+  self->ring.frames = NULL;
+  self->ring.size = self->ring.head = self->ring.length = 0;
+  self->pool = NULL;
+  memset (&self->window, 0, sizeof (GstTensorAggregatorWindow));
+  g_queue_init (&self->window.timestamps);
   gst_tensor_aggregator_reset (self);
 }
 
@@ -340,6 +368,43 @@ gst_tensor_aggregator_set_property (GObject * object, guint prop_id,
     case PROP_FRAMES_DIMENSION:
       self->frames_dim = g_value_get_uint (value);
       break;
+    case PROP_FRAMES_DIMENSIONS:
+    {
+      const gchar *str = g_value_get_string (value);
+      gchar **dims;
+      guint i, num;
+      guint64 val;
+
+      self->num_frames_dims = 0;
+
+      if (str == NULL || str[0] == '\0')
+        break;
+
+      dims = g_strsplit_set (str, ",", -1);
+      num = g_strv_length (dims);
+
+      if (num > NNS_TENSOR_SIZE_LIMIT) {
+        GST_WARNING_OBJECT (self, "Invalid frames-dims %s, max size is %d",
+            str, NNS_TENSOR_SIZE_LIMIT);
+        num = NNS_TENSOR_SIZE_LIMIT;
+      }
+
+      for (i = 0; i < num; i++) {
+        val = g_ascii_strtoull (dims[i], NULL, 10);
+
+        if (val >= NNS_TENSOR_RANK_LIMIT) {
+          GST_ERROR_OBJECT (self, "Invalid frames-dims %s", str);
+          self->num_frames_dims = 0;
+          break;
+        }
+
+        self->frames_dims[i] = (guint) val;
+        self->num_frames_dims = i + 1;
+      }
+
+      g_strfreev (dims);
+      break;
+    }
     case PROP_CONCAT:
       self->concat = g_value_get_boolean (value);
       break;
@@ -376,6 +441,20 @@ gst_tensor_aggregator_get_property (GObject * object, guint prop_id,
     case PROP_FRAMES_DIMENSION:
       g_value_set_uint (value, self->frames_dim);
       break;
+    case PROP_FRAMES_DIMENSIONS:
+    {
+      GString *dims = g_string_new (NULL);
+      guint i;
+
+      for (i = 0; i < self->num_frames_dims; i++) {
+        if (i > 0)
+          g_string_append_c (dims, ',');
+        g_string_append_printf (dims, "%u", self->frames_dims[i]);
+      }
+
+      g_value_take_string (value, g_string_free (dims, FALSE));
+      break;
+    }
     case PROP_CONCAT:
       g_value_set_boolean (value, self->concat);
       break;
@@ -412,7 +491,7 @@ gst_tensor_aggregator_sink_event (GstPad * pad, GstObject * parent,
       silent_debug_caps (in_caps, "in-caps");
 
       if (gst_tensor_aggregator_parse_caps (self, in_caps)) {
-        out_caps = gst_tensor_caps_from_config (&self->out_config);
+        out_caps = gst_tensor_aggregator_get_caps (self, &self->out_config);
         silent_debug_caps (out_caps, "out-caps");
 
         gst_pad_set_caps (self->srcpad, out_caps);
@@ -522,15 +601,31 @@ gst_tensor_aggregator_src_query (GstPad * pad, GstObject * parent,
   return gst_pad_query_default (pad, parent, query);
 }
 
+/**
+ * @brief Get the dimension index of frames in the tensor.
+ * @param self this pointer to GstTensorAggregator
+ * @param nth index of the tensor
+ * @return dimension index of frames
+ */
+static guint
+gst_tensor_aggregator_get_frames_dim (GstTensorAggregator * self, guint nth)
+{
+  if (nth < self->num_frames_dims)
+    return self->frames_dims[nth];
+
+  return self->frames_dim;
+}
+
 /**
  * @brief Check tensor dimension and axis to concatenate data.
  * @param self this pointer to GstTensorAggregator
  * @param info tensor info for one frame
+ * @param frames_dim dimension index of frames in the tensor
  * @return True if needed to concatenate
  */
 static gboolean
 gst_tensor_aggregator_check_concat_axis (GstTensorAggregator * self,
-    const GstTensorInfo * info)
+    const GstTensorInfo * info, guint frames_dim)
 {
   guint i;
 
@@ -540,7 +635,7 @@ gst_tensor_aggregator_check_concat_axis (GstTensorAggregator * self,
    * Check condition to concatenate data.
    */
   if (self->concat && self->frames_out > 1) {
-    for (i = self->frames_dim + 1; i < NNS_TENSOR_RANK_LIMIT; i++) {
+    for (i = frames_dim + 1; i < NNS_TENSOR_RANK_LIMIT; i++) {
       if (info->dimension[i] > 1) {
         /** concatenate data */
         return TRUE;
@@ -552,30 +647,133 @@ gst_tensor_aggregator_check_concat_axis (GstTensorAggregator * self,
 }
 
 /**
- * @brief Change the data in buffer with given axis.
+ * @brief Get the tensor info for one frame.
  * @param self this pointer to GstTensorAggregator
- * @param outbuf buffer to be concatenated
- * @param info tensor info for one frame
+ * @param nth index of the tensor
+ * @param info tensor info to be filled
+ */
+static void
+gst_tensor_aggregator_get_frame_info (GstTensorAggregator * self, guint nth,
+    GstTensorInfo * info)
+{
+  guint frames_dim;
+
+  frames_dim = gst_tensor_aggregator_get_frames_dim (self, nth);
+  g_assert (frames_dim < NNS_TENSOR_RANK_LIMIT);
+
+  *info = self->out_config.info.info[nth];
+  info->dimension[frames_dim] /= self->frames_out;
+}
+
+/**
+ * @brief Map the nth tensor in the buffer.
+ * @note The buffer of other/tensor may have several memories, the buffer of other/tensors has a memory for each tensor.
+ */
+static gboolean
+gst_tensor_aggregator_map_tensor (GstTensorAggregator * self, GstBuffer * buf,
+    guint nth, GstMapInfo * info, GstMapFlags flags)
+{
+  if (self->is_tensors) {
+    return gst_memory_map (gst_buffer_peek_memory (buf, nth), info, flags);
+  }
+
+  return gst_buffer_map (buf, info, flags);
+}
+
+/**
+ * @brief Unmap the tensor mapped with gst_tensor_aggregator_map_tensor ().
+ */
+static void
+gst_tensor_aggregator_unmap_tensor (GstTensorAggregator * self,
+    GstBuffer * buf, GstMapInfo * info)
+{
+  if (self->is_tensors) {
+    gst_memory_unmap (info->memory, info);
+  } else {
+    gst_buffer_unmap (buf, info);
+  }
+}
+
+/**
+ * @brief Get the frame in the ring.
+ * @param ring the ring of frames
+ * @param index index of the frame from the oldest one
+ */
+static inline GstTensorAggregatorFrame *
+gst_tensor_aggregator_ring_peek (GstTensorAggregatorRing * ring, guint index)
+{
+  return &ring->frames[(ring->head + index) % ring->size];
+}
+
+/**
+ * @brief Remove the oldest frames in the ring.
+ * @param ring the ring of frames
+ * @param count the number of frames to be removed
  */
 static void
+gst_tensor_aggregator_ring_flush (GstTensorAggregatorRing * ring, guint count)
+{
+  GstTensorAggregatorFrame *frame;
+
+  count = MIN (count, ring->length);
+
+  while (count > 0) {
+    frame = gst_tensor_aggregator_ring_peek (ring, 0);
+    gst_buffer_unref (frame->buffer);
+    frame->buffer = NULL;
+
+    ring->head = (ring->head + 1) % ring->size;
+    ring->length--;
+    count--;
+  }
+}
+
+/**
+ * @brief Release the frames and the ring.
+ * @param ring the ring of frames
+ */
+static void
+gst_tensor_aggregator_ring_clear (GstTensorAggregatorRing * ring)
+{
+  if (ring->frames) {
+    gst_tensor_aggregator_ring_flush (ring, ring->length);
+    g_free (ring->frames);
+  }
+
+  ring->frames = NULL;
+  ring->size = ring->head = ring->length = 0;
+}
+
+/**
+ * @brief Write the frames of nth tensor in the ring into the output buffer with given axis.
+ * @param self this pointer to GstTensorAggregator
+ * @param outbuf buffer to be filled (size of frames-out)
+ * @param nth index of the tensor
+ * @return TRUE if successfully written
+ */
+static gboolean
 gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * outbuf,
-    const GstTensorInfo * info)
+    guint nth)
 {
-  GstBuffer *srcbuf;
+  GstTensorAggregatorFrame *frame;
+  GstTensorInfo info;
   GstMapInfo src_info, dest_info;
-  guint f;
-  gsize block_size;
-  gsize src_idx, dest_idx;
+  guint f, frames_dim;
+  gsize block_size, block_stride;
+  gsize src_idx, dest_idx, offset;
   gsize frame_size;
 
-  frame_size = gst_tensor_info_get_size (info);
-  g_assert (frame_size > 0);
+  gst_tensor_aggregator_get_frame_info (self, nth, &info);
+  frames_dim = gst_tensor_aggregator_get_frames_dim (self, nth);
 
-  srcbuf = gst_buffer_copy (outbuf);
-  outbuf = gst_buffer_make_writable (outbuf);
+  frame_size = gst_tensor_info_get_size (&info);
+  g_assert (frame_size > 0);
 
-  g_assert (gst_buffer_map (srcbuf, &src_info, GST_MAP_READ));
-  g_assert (gst_buffer_map (outbuf, &dest_info, GST_MAP_WRITE));
+  if (!gst_tensor_aggregator_map_tensor (self, outbuf, nth, &dest_info,
+          GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (self, "Failed to map output buffer.");
+    return FALSE;
+  }
 
   /**
    * Concatenate output buffer with given axis (frames-dim)
@@ -752,55 +950,491 @@ gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * outbuf,
    ********************************************************************
    */
 
-  /** get block size */
-  block_size = gst_tensor_get_element_size (info->type);
-  for (f = 0; f <= self->frames_dim; f++) {
-    block_size *= info->dimension[f];
+  /**
+   * get block size
+   * If the frames are not concatenated (frames-dim is outermost), the block is a frame.
+   */
+  block_size = gst_tensor_get_element_size (info.type);
+  for (f = 0; f <= frames_dim; f++) {
+    block_size *= info.dimension[f];
   }
 
-  src_idx = dest_idx = 0;
+  if (!gst_tensor_aggregator_check_concat_axis (self, &info, frames_dim))
+    block_size = frame_size;
+
+  /**
+   * Each block of the frame f is written at (block index * frames-out + f).
+   * The frames are read from the incoming buffers, the data is written once in output buffer.
+   */
+  block_stride = block_size * self->frames_out;
+  g_assert (dest_info.size == frame_size * self->frames_out);
+
+  for (f = 0; f < self->frames_out; f++) {
+    frame = gst_tensor_aggregator_ring_peek (&self->ring, f);
 
-  do {
-    for (f = 0; f < self->frames_out; f++) {
+    if (!gst_tensor_aggregator_map_tensor (self, frame->buffer, nth,
+            &src_info, GST_MAP_READ)) {
+      GST_ERROR_OBJECT (self, "Failed to map incoming buffer.");
+      gst_tensor_aggregator_unmap_tensor (self, outbuf, &dest_info);
+      return FALSE;
+    }
+
+    offset = frame_size * frame->index;
+    g_assert (offset + frame_size <= src_info.size);
+
+    dest_idx = block_size * f;
+    for (src_idx = 0; src_idx < frame_size; src_idx += block_size) {
       nns_memcpy (dest_info.data + dest_idx,
-          src_info.data + src_idx + (frame_size * f), block_size);
-      dest_idx += block_size;
+          src_info.data + offset + src_idx, block_size);
+      dest_idx += block_stride;
+    }
+
+    gst_tensor_aggregator_unmap_tensor (self, frame->buffer, &src_info);
+  }
+
+  gst_tensor_aggregator_unmap_tensor (self, outbuf, &dest_info);
+  return TRUE;
+}
+
+/**
+ * @brief Get the output buffer to write the frames.
+ * @note The buffer of single tensor is from the pool, the buffer of multiple tensors has a memory for each tensor.
+ */
+static GstBuffer *
+gst_tensor_aggregator_alloc_output (GstTensorAggregator * self)
+{
+  GstBuffer *outbuf = NULL;
+  GstMemory *mem;
+  gsize size;
+  guint i;
+
+  if (self->pool) {
+    if (gst_buffer_pool_acquire_buffer (self->pool, &outbuf,
+            NULL) != GST_FLOW_OK)
+      return NULL;
+
+    return outbuf;
+  }
+
+  outbuf = gst_buffer_new ();
+
+  for (i = 0; i < self->out_config.info.num_tensors; i++) {
+    size = gst_tensor_info_get_size (&self->out_config.info.info[i]);
+
+    mem = gst_allocator_alloc (NULL, size, NULL);
+    if (mem == NULL) {
+      gst_buffer_unref (outbuf);
+      return NULL;
+    }
+
+    gst_buffer_append_memory (outbuf, mem);
+  }
+
+  return outbuf;
+}
+
+/**
+ * @brief Check the incoming buffer has the frames of each tensor.
+ */
+static gboolean
+gst_tensor_aggregator_check_input (GstTensorAggregator * self, GstBuffer * buf)
+{
+  GstTensorsInfo *info = &self->in_config.info;
+  guint i;
+
+  if (!self->is_tensors) {
+    return (gst_buffer_get_size (buf) >=
+        gst_tensor_info_get_size (&info->info[0]));
+  }
+
+  if (gst_buffer_n_memory (buf) != info->num_tensors)
+    return FALSE;
+
+  for (i = 0; i < info->num_tensors; i++) {
+    if (gst_memory_get_sizes (gst_buffer_peek_memory (buf, i), NULL, NULL) <
+        gst_tensor_info_get_size (&info->info[i]))
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Add the frames in incoming buffer to the ring and push the aggregated buffers.
+ * @param self this pointer to GstTensorAggregator
+ * @param buf incoming buffer, this function takes the ownership
+ * @param duration duration of the output buffer
+ */
+static GstFlowReturn
+gst_tensor_aggregator_push_frames (GstTensorAggregator * self, GstBuffer * buf,
+    GstClockTime duration)
+{
+  GstTensorAggregatorRing *ring;
+  GstTensorAggregatorFrame *frame;
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstClockTime pts, dts, frame_duration;
+  guint i, flush;
+
+  ring = &self->ring;
+  g_assert (ring->frames != NULL);
+
+  if (!gst_tensor_aggregator_check_input (self, buf)) {
+    GST_ERROR_OBJECT (self, "Invalid incoming buffer, the size of tensors "
+        "is different from the configured tensors.");
+    gst_buffer_unref (buf);
+    return GST_FLOW_ERROR;
+  }
+
+  pts = GST_BUFFER_PTS (buf);
+  dts = GST_BUFFER_DTS (buf);
+
+  /**
+   * Update timestamp of each frame in incoming buffer.
+   * Same as the adapter, the frame is supposed to have the duration of input framerate.
+   */
+  frame_duration = 0;
+  if (self->frames_in > 1) {
+    gint fn, fd;
+
+    fn = self->in_config.rate_n;
+    fd = self->in_config.rate_d;
+
+    if (fn > 0 && fd > 0)
+      frame_duration = gst_util_uint64_scale_int (GST_SECOND, fd, fn);
+  }
+
+  /** add the frames (the ring has a room for incoming frames) */
+  g_assert (ring->length + self->frames_in <= ring->size);
+
+  for (i = 0; i < self->frames_in; i++) {
+    frame = gst_tensor_aggregator_ring_peek (ring, ring->length);
+
+    frame->buffer = gst_buffer_ref (buf);
+    frame->index = i;
+    frame->pts = GST_CLOCK_TIME_IS_VALID (pts) ? pts + frame_duration * i : pts;
+    frame->dts = GST_CLOCK_TIME_IS_VALID (dts) ? dts + frame_duration * i : dts;
+
+    ring->length++;
+  }
+
+  gst_buffer_unref (buf);
+
+  while (ring->length >= self->frames_out && ret == GST_FLOW_OK) {
+    GstBuffer *outbuf;
+
+    outbuf = gst_tensor_aggregator_alloc_output (self);
+    if (outbuf == NULL) {
+      GST_ERROR_OBJECT (self, "Failed to allocate output buffer.");
+      ret = GST_FLOW_ERROR;
+      break;
     }
 
-    src_idx += block_size;
+    for (i = 0; i < self->out_config.info.num_tensors; i++) {
+      if (!gst_tensor_aggregator_concat (self, outbuf, i)) {
+        ret = GST_FLOW_ERROR;
+        break;
+      }
+    }
+
+    if (ret != GST_FLOW_OK) {
+      gst_buffer_unref (outbuf);
+      break;
+    }
+
+    /** set timestamp */
+    frame = gst_tensor_aggregator_ring_peek (ring, 0);
+    GST_BUFFER_PTS (outbuf) = frame->pts;
+    GST_BUFFER_DTS (outbuf) = frame->dts;
+    GST_BUFFER_DURATION (outbuf) = duration;
+
+    ret = gst_pad_push (self->srcpad, outbuf);
+
+    /**
+     * flush frames (all output frames if frames-flush is 0)
+     * Same as pushing the incoming buffer, all frames are flushed if frames-in and frames-out are same.
+     */
+    flush = self->frames_out;
+    if (self->frames_flush > 0 && self->frames_in != self->frames_out)
+      flush = self->frames_flush;
+
+    gst_tensor_aggregator_ring_flush (ring, flush);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Timestamps and offset of incoming buffer for overlapping windows.
+ */
+typedef struct
+{
+  guint64 offset; /**< offset in the stream (bytes) */
+  GstClockTime pts; /**< presentation timestamp */
+  GstClockTime dts; /**< decoding timestamp */
+} GstTensorAggregatorWindowTs;
+
+/**
+ * @brief Clear the frames and timestamps of overlapping windows.
+ */
+static void
+gst_tensor_aggregator_window_clear (GstTensorAggregatorWindow * window)
+{
+  if (window->mem) {
+    gst_memory_unref (window->mem);
+    window->mem = NULL;
+  }
+
+  window->data = NULL;
+  window->size = 0;
+  window->write_pos = window->read_pos = 0;
+  window->write_offset = window->read_offset = 0;
 
-    g_assert (src_idx <= frame_size);
-    g_assert (dest_idx <= dest_info.size);
-  } while (src_idx < frame_size);
+  g_queue_foreach (&window->timestamps, (GFunc) g_free, NULL);
+  g_queue_clear (&window->timestamps);
+}
+
+/**
+ * @brief Prepare the memory block to write incoming frames.
+ * @note The frames of next window are copied into new block when the block is full.
+ */
+static gboolean
+gst_tensor_aggregator_window_prepare (GstTensorAggregatorWindow * window,
+    gsize window_size, gsize flush_size)
+{
+  GstMemory *mem;
+  guint8 *data;
+  gsize size, remain;
+
+  if (window->mem && window->write_pos < window->size)
+    return TRUE;
+
+  /* the block has the window and several flushes, the copy of next window is amortized */
+  size = window_size +
+      MAX (WINDOW_MIN_FLUSHES_IN_BLOCK * window_size / flush_size,
+      WINDOW_MIN_FLUSHES_IN_BLOCK) * flush_size;
+
+  /**
+   * The data is freed when all windows shared from the block are released.
+   * The element writes the data only after the last window.
+   */
+  data = (guint8 *) g_try_malloc (size);
+  if (data == NULL)
+    return FALSE;
+
+  mem = gst_memory_new_wrapped (0, data, size, 0, size, data, g_free);
+  if (mem == NULL) {
+    g_free (data);
+    return FALSE;
+  }
+
+  remain = 0;
+  if (window->mem) {
+    remain = window->write_pos - window->read_pos;
+    if (remain > 0)
+      memcpy (data, window->data + window->read_pos, remain);
+
+    gst_memory_unref (window->mem);
+  }
+
+  window->mem = mem;
+  window->data = data;
+  window->size = size;
+  window->read_pos = 0;
+  window->write_pos = remain;
+  return TRUE;
+}
+
+/**
+ * @brief Get the timestamp of the window.
+ */
+static void
+gst_tensor_aggregator_window_get_timestamp (GstTensorAggregator * self,
+    gsize frame_size, GstClockTime * pts, GstClockTime * dts)
+{
+  GstTensorAggregatorWindow *window = &self->window;
+  GstTensorAggregatorWindowTs *ts, *next;
+  guint64 dist;
+  gint fn, fd;
+
+  /* remove the timestamps of old buffers before the window */
+  while ((next = g_queue_peek_nth (&window->timestamps, 1)) != NULL &&
+      next->offset <= window->read_offset) {
+    g_free (g_queue_pop_head (&window->timestamps));
+  }
+
+  ts = g_queue_peek_head (&window->timestamps);
+  g_assert (ts != NULL);
+
+  *pts = ts->pts;
+  *dts = ts->dts;
 
-  gst_buffer_unmap (srcbuf, &src_info);
-  gst_buffer_unmap (outbuf, &dest_info);
+  /* same with adapter, update timestamp with the distance from the buffer */
+  fn = self->in_config.rate_n;
+  fd = self->in_config.rate_d;
 
-  gst_buffer_unref (srcbuf);
+  if (self->frames_in > 1 && fn > 0 && fd > 0) {
+    dist = window->read_offset - ts->offset;
+
+    if (GST_CLOCK_TIME_IS_VALID (*pts)) {
+      *pts += gst_util_uint64_scale (dist, fd * GST_SECOND,
+          (guint64) fn * frame_size);
+    }
+
+    if (GST_CLOCK_TIME_IS_VALID (*dts)) {
+      *dts += gst_util_uint64_scale (dist, fd * GST_SECOND,
+          (guint64) fn * frame_size);
+    }
+  }
 }
 
 /**
- * @brief Push the buffer to source pad. (Concatenate the buffer if needed)
+ * @brief Push the overlapping windows of frames (frames-flush < frames-out).
+ * @note The incoming frames are written once, each window is a shared memory of the block without copy.
+ * The shared memory is read-only, downstream gets a copy only when it maps the buffer writable.
  */
 static GstFlowReturn
-gst_tensor_aggregator_push (GstTensorAggregator * self, GstBuffer * outbuf,
-    gsize frame_size)
+gst_tensor_aggregator_push_windows (GstTensorAggregator * self,
+    GstBuffer * inbuf, gsize frame_size, GstClockTime duration)
+{
+  GstTensorAggregatorWindow *window = &self->window;
+  GstTensorAggregatorWindowTs *ts;
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstMapInfo info;
+  gsize window_size, flush_size, remain, len;
+  const guint8 *src;
+
+  window_size = frame_size * self->frames_out;
+  flush_size = frame_size * self->frames_flush;
+
+  ts = g_new (GstTensorAggregatorWindowTs, 1);
+  ts->offset = window->write_offset;
+  ts->pts = GST_BUFFER_PTS (inbuf);
+  ts->dts = GST_BUFFER_DTS (inbuf);
+  g_queue_push_tail (&window->timestamps, ts);
+
+  if (!gst_buffer_map (inbuf, &info, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Failed to map incoming buffer.");
+    gst_buffer_unref (inbuf);
+    return GST_FLOW_ERROR;
+  }
+
+  src = info.data;
+  remain = info.size;
+
+  while (remain > 0 && ret == GST_FLOW_OK) {
+    if (!gst_tensor_aggregator_window_prepare (window, window_size,
+            flush_size)) {
+      GST_ERROR_OBJECT (self, "Failed to allocate memory for the windows.");
+      ret = GST_FLOW_ERROR;
+      break;
+    }
+
+    len = MIN (remain, window->size - window->write_pos);
+    memcpy (window->data + window->write_pos, src, len);
+
+    window->write_pos += len;
+    window->write_offset += len;
+    src += len;
+    remain -= len;
+
+    while (window->write_pos - window->read_pos >= window_size &&
+        ret == GST_FLOW_OK) {
+      GstBuffer *outbuf;
+      GstClockTime pts, dts;
+
+      gst_tensor_aggregator_window_get_timestamp (self, frame_size, &pts,
+          &dts);
+
+      outbuf = gst_buffer_new ();
+      gst_buffer_append_memory (outbuf,
+          gst_memory_share (window->mem, window->read_pos, window_size));
+
+      /** set timestamp */
+      GST_BUFFER_PTS (outbuf) = pts;
+      GST_BUFFER_DTS (outbuf) = dts;
+      GST_BUFFER_DURATION (outbuf) = duration;
+
+      window->read_pos += flush_size;
+      window->read_offset += flush_size;
+
+      ret = gst_pad_push (self->srcpad, outbuf);
+    }
+  }
+
+  gst_buffer_unmap (inbuf, &info);
+  gst_buffer_unref (inbuf);
+  return ret;
+}
+
+/**
+ * @brief Prepare the ring and buffer pool to concatenate the frames.
+ * @param self this pointer to GstTensorAggregator
+ * @return TRUE if successfully prepared (or the ring is not needed)
+ * @note The ring is used if the frames are concatenated, or the stream has multiple tensors.
+ */
+static gboolean
+gst_tensor_aggregator_prepare_ring (GstTensorAggregator * self)
 {
   GstTensorInfo info;
+  GstStructure *config;
+  GstCaps *caps;
+  gsize out_size;
+  gboolean need_ring;
+  guint i, num;
+
+  gst_tensor_aggregator_ring_clear (&self->ring);
+
+  if (self->pool) {
+    gst_buffer_pool_set_active (self->pool, FALSE);
+    gst_object_unref (self->pool);
+    self->pool = NULL;
+  }
+
+  num = self->out_config.info.num_tensors;
 
-  /** tensor info for one frame */
-  info = self->out_config.info;
-  g_assert (self->frames_dim < NNS_TENSOR_RANK_LIMIT);
-  info.dimension[self->frames_dim] /= self->frames_out;
+  /** the frames of multiple tensors are aggregated together in the ring */
+  need_ring = (num > 1);
+  for (i = 0; i < num && !need_ring; i++) {
+    gst_tensor_aggregator_get_frame_info (self, i, &info);
 
-  g_assert (frame_size == gst_tensor_info_get_size (&info));
+    need_ring = gst_tensor_aggregator_check_concat_axis (self, &info,
+        gst_tensor_aggregator_get_frames_dim (self, i));
+  }
 
-  if (gst_tensor_aggregator_check_concat_axis (self, &info)) {
-    /** change data in buffer with given axis */
-    gst_tensor_aggregator_concat (self, outbuf, &info);
+  if (!need_ring) {
+    /** the frames in adapter are pushed without concatenation */
+    return TRUE;
   }
 
-  return gst_pad_push (self->srcpad, outbuf);
+  /**
+   * The ring holds less than frames-out frames before adding incoming buffer.
+   * (The frames are flushed when the number of frames in the ring is larger than frames-out.)
+   */
+  self->ring.size = self->frames_out + self->frames_in;
+  self->ring.frames = g_new0 (GstTensorAggregatorFrame, self->ring.size);
+
+  /** the buffer of multiple tensors has a memory for each tensor, allocated when pushing a buffer */
+  if (num > 1)
+    return TRUE;
+
+  out_size = gst_tensor_info_get_size (&self->out_config.info.info[0]);
+  caps = gst_tensor_aggregator_get_caps (self, &self->out_config);
+
+  self->pool = gst_buffer_pool_new ();
+  config = gst_buffer_pool_get_config (self->pool);
+  gst_buffer_pool_config_set_params (config, caps, out_size, 0, 0);
+  gst_caps_unref (caps);
+
+  if (!gst_buffer_pool_set_config (self->pool, config) ||
+      !gst_buffer_pool_set_active (self->pool, TRUE)) {
+    GST_ERROR_OBJECT (self, "Failed to activate buffer pool.");
+    gst_object_unref (self->pool);
+    self->pool = NULL;
+    gst_tensor_aggregator_ring_clear (&self->ring);
+    return FALSE;
+  }
+
+  return TRUE;
 }
 
 /**
@@ -827,20 +1461,30 @@ gst_tensor_aggregator_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   frames_flush = self->frames_flush;
   frame_size = buf_size / frames_in;
 
-  if (frames_in == frames_out) {
-    /** push the incoming buffer (do concat if needed) */
-    return gst_tensor_aggregator_push (self, buf, frame_size);
-  }
-
-  adapter = self->adapter;
-  g_assert (adapter != NULL);
-
   duration = GST_BUFFER_DURATION (buf);
   if (GST_CLOCK_TIME_IS_VALID (duration)) {
     /** supposed same duration for incoming buffer */
     duration = gst_util_uint64_scale_int (duration, frames_out, frames_in);
   }
 
+  if (self->ring.frames) {
+    /** concatenate the frames with given axis (or aggregate the frames of multiple tensors) */
+    return gst_tensor_aggregator_push_frames (self, buf, duration);
+  }
+
+  if (frames_in == frames_out) {
+    /** push the incoming buffer */
+    return gst_pad_push (self->srcpad, buf);
+  }
+
+  if (frames_flush > 0 && frames_flush < frames_out) {
+    /** overlapping windows, each window is shared from the frames without copy */
+    return gst_tensor_aggregator_push_windows (self, buf, frame_size, duration);
+  }
+
+  adapter = self->adapter;
+  g_assert (adapter != NULL);
+
   gst_adapter_push (adapter, buf);
 
   out_size = frame_size * frames_out;
@@ -889,7 +1533,7 @@ gst_tensor_aggregator_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
     GST_BUFFER_DTS (outbuf) = dts;
     GST_BUFFER_DURATION (outbuf) = duration;
 
-    ret = gst_tensor_aggregator_push (self, outbuf, frame_size);
+    ret = gst_pad_push (self->srcpad, outbuf);
 
     /** flush data */
     if (frames_flush > 0) {
@@ -957,9 +1601,19 @@ gst_tensor_aggregator_reset (GstTensorAggregator * self)
     gst_adapter_clear (self->adapter);
   }
 
+  gst_tensor_aggregator_ring_clear (&self->ring);
+  gst_tensor_aggregator_window_clear (&self->window);
+
+  if (self->pool) {
+    gst_buffer_pool_set_active (self->pool, FALSE);
+    gst_object_unref (self->pool);
+    self->pool = NULL;
+  }
+
   self->tensor_configured = FALSE;
-  gst_tensor_config_init (&self->in_config);
-  gst_tensor_config_init (&self->out_config);
+  self->is_tensors = FALSE;
+  gst_tensors_config_init (&self->in_config);
+  gst_tensors_config_init (&self->out_config);
 }
 
 /**
@@ -970,17 +1624,17 @@ gst_tensor_aggregator_query_caps (GstTensorAggregator * self, GstPad * pad,
     GstCaps * filter)
 {
   GstCaps *caps;
-  GstTensorConfig config;
+  GstTensorsConfig *config;
 
   /* tensor config info for given pad */
   if (pad == self->sinkpad) {
-    config = self->in_config;
+    config = &self->in_config;
   } else {
-    config = self->out_config;
+    config = &self->out_config;
   }
 
   /* caps from tensor config info */
-  caps = gst_tensor_caps_from_config (&config);
+  caps = gst_tensor_aggregator_get_caps (self, config);
 
   silent_debug_caps (caps, "caps");
   silent_debug_caps (filter, "filter");
@@ -998,6 +1652,36 @@ gst_tensor_aggregator_query_caps (GstTensorAggregator * self, GstPad * pad,
   return caps;
 }
 
+/**
+ * @brief Get caps from tensors config (other/tensor or other/tensors of incoming stream).
+ */
+static GstCaps *
+gst_tensor_aggregator_get_caps (GstTensorAggregator * self,
+    const GstTensorsConfig * config)
+{
+  GstTensorConfig c;
+  GstCaps *caps;
+  gboolean configured;
+
+  configured = (config->info.num_tensors > 0);
+
+  if (configured && self->is_tensors)
+    return gst_tensors_caps_from_config (config);
+
+  gst_tensor_config_init (&c);
+  c.info = config->info.info[0];
+  c.rate_n = config->rate_n;
+  c.rate_d = config->rate_d;
+  caps = gst_tensor_caps_from_config (&c);
+
+  if (!configured) {
+    /* not negotiated yet, other/tensor or other/tensors */
+    caps = gst_caps_merge (caps, gst_tensors_caps_from_config (config));
+  }
+
+  return caps;
+}
+
 /**
  * @brief Parse caps and set tensor info.
  */
@@ -1006,22 +1690,25 @@ gst_tensor_aggregator_parse_caps (GstTensorAggregator * self,
     const GstCaps * caps)
 {
   GstStructure *structure;
-  GstTensorConfig config;
+  GstTensorsConfig config;
   uint32_t per_frame;
-  guint count;
+  guint count, i, frames_dim;
 
   g_return_val_if_fail (caps != NULL, FALSE);
   g_return_val_if_fail (gst_caps_is_fixed (caps), FALSE);
 
   structure = gst_caps_get_structure (caps, 0);
-  if (!gst_structure_has_name (structure, "other/tensor")) {
-    GST_ERROR_OBJECT (self, "Invalid caps");
+
+  if (!gst_tensors_config_from_structure (&config, structure) ||
+      !gst_tensors_config_validate (&config)) {
+    GST_ERROR_OBJECT (self, "Cannot configure tensor info");
     return FALSE;
   }
 
-  if (!gst_tensor_config_from_structure (&config, structure) ||
-      !gst_tensor_config_validate (&config)) {
-    GST_ERROR_OBJECT (self, "Cannot configure tensor info");
+  if (self->num_frames_dims > 0 &&
+      self->num_frames_dims != config.info.num_tensors) {
+    GST_ERROR_OBJECT (self, "Invalid frames-dims, the number of tensors is %u",
+        config.info.num_tensors);
     return FALSE;
   }
 
@@ -1041,13 +1728,31 @@ gst_tensor_aggregator_parse_caps (GstTensorAggregator * self,
    * if frames_out=10 and frames_dim=3, then out-dimension is 2:200:200:10.
    * if frames_out=10 and frames_dim=2, then out-dimension is 2:200:2000:1.
    */
-  g_assert (self->frames_dim < NNS_TENSOR_RANK_LIMIT);
-  g_assert ((config.info.dimension[self->frames_dim] % self->frames_in) == 0);
-  per_frame = config.info.dimension[self->frames_dim] / self->frames_in;
+  for (i = 0; i < config.info.num_tensors; i++) {
+    frames_dim = gst_tensor_aggregator_get_frames_dim (self, i);
+    g_assert (frames_dim < NNS_TENSOR_RANK_LIMIT);
+
+    if ((config.info.info[i].dimension[frames_dim] % self->frames_in) != 0) {
+      GST_ERROR_OBJECT (self, "Invalid dimension of tensor %u, "
+          "the dimension %u is not a multiple of frames-in", i, frames_dim);
+      return FALSE;
+    }
 
-  config.info.dimension[self->frames_dim] = per_frame * self->frames_out;
+    per_frame = config.info.info[i].dimension[frames_dim] / self->frames_in;
+    config.info.info[i].dimension[frames_dim] = per_frame * self->frames_out;
+  }
 
   self->out_config = config;
+  self->is_tensors = gst_structure_has_name (structure, "other/tensors");
+
+  /** clear the frames of previous caps */
+  gst_tensor_aggregator_window_clear (&self->window);
+
+  if (!gst_tensor_aggregator_prepare_ring (self)) {
+    GST_ERROR_OBJECT (self, "Failed to prepare the frames to concatenate");
+    return FALSE;
+  }
+
   self->tensor_configured = TRUE;
 
   silent_debug_config (&self->in_config, "in-tensor");
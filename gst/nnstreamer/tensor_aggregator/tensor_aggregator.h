@@ -47,6 +47,46 @@ G_BEGIN_DECLS
 typedef struct _GstTensorAggregator GstTensorAggregator;
 typedef struct _GstTensorAggregatorClass GstTensorAggregatorClass;
 
+/**
+ * @brief A frame in the ring, pointing to the incoming buffer holding the frame.
+ */
+typedef struct
+{
+  GstBuffer *buffer; /**< incoming buffer (the frame is not copied) */
+  guint index; /**< index of the frame in the buffer (the frame of each tensor) */
+  GstClockTime pts; /**< presentation timestamp of the frame */
+  GstClockTime dts; /**< decoding timestamp of the frame */
+} GstTensorAggregatorFrame;
+
+/**
+ * @brief The ring of frames to be concatenated (or aggregated with multiple tensors).
+ * Each frame is written once into its position in the output buffer when the frames are enough.
+ */
+typedef struct
+{
+  GstTensorAggregatorFrame *frames; /**< the frames */
+  guint size; /**< max number of frames in the ring */
+  guint head; /**< index of the oldest frame */
+  guint length; /**< number of frames in the ring */
+} GstTensorAggregatorRing;
+
+/**
+ * @brief Data structure to push the overlapping windows of frames (frames-flush < frames-out).
+ * The incoming frames are written once into the memory block, and the windows are shared from the block.
+ * When the block is full, the frames of next window are copied to new block.
+ */
+typedef struct
+{
+  GstMemory *mem; /**< memory block to collect the frames */
+  guint8 *data; /**< data of the memory block */
+  gsize size; /**< size of the memory block */
+  gsize write_pos; /**< offset in the block to write incoming frames */
+  gsize read_pos; /**< offset in the block of next window */
+  guint64 read_offset; /**< offset in the stream (bytes) of next window */
+  guint64 write_offset; /**< offset in the stream (bytes) of next incoming frames */
+  GQueue timestamps; /**< timestamps and offsets of incoming buffers */
+} GstTensorAggregatorWindow;
+
 /**
  * @brief GstTensorAggregator data structure.
  */
@@ -63,12 +103,18 @@ struct _GstTensorAggregator
   guint frames_out; /**< number of frames in output buffer */
   guint frames_flush; /**< number of frames to flush */
   guint frames_dim; /**< index of frames in tensor dimension */
+  guint frames_dims[NNS_TENSOR_SIZE_LIMIT]; /**< index of frames in the dimension of each tensor (other/tensors) */
+  guint num_frames_dims; /**< the number of frames_dims, frames_dim is used if not given */
 
   GstAdapter *adapter; /**< adapt incoming tensor */
+  GstTensorAggregatorRing ring; /**< frames to be concatenated (or aggregated with multiple tensors) */
+  GstBufferPool *pool; /**< pool of the concatenated output buffers */
+  GstTensorAggregatorWindow window; /**< overlapping windows of frames without concatenation */
 
   gboolean tensor_configured; /**< True if already successfully configured tensor metadata */
-  GstTensorConfig in_config; /**< input tensor info */
-  GstTensorConfig out_config; /**< output tensor info */
+  gboolean is_tensors; /**< True if the stream is other/tensors */
+  GstTensorsConfig in_config; /**< input tensors info */
+  GstTensorsConfig out_config; /**< output tensors info */
 };
 
 /**
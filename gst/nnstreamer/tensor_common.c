@@ -1138,6 +1138,7 @@ static const gchar *gst_tensor_time_sync_mode_string[] = {
   [SYNC_NOSYNC] = "nosync",
   [SYNC_SLOWEST] = "slowest",
   [SYNC_BASEPAD] = "basepad",
+  [SYNC_REFRESH] = "refresh",
   [SYNC_END] = NULL
 };
 
@@ -1174,7 +1175,11 @@ gst_tensor_time_sync_get_mode_string (tensor_time_sync_mode mode)
 gboolean
 gst_tensor_time_sync_set_option_data (tensor_time_sync_data * sync)
 {
-  if (sync->mode == SYNC_END || sync->option == NULL)
+  if (sync->mode == SYNC_END)
+    return FALSE;
+
+  /* refresh mode works without the option (base pad 0 without timeout) */
+  if (sync->option == NULL && sync->mode != SYNC_REFRESH)
     return FALSE;
 
   switch (sync->mode) {
@@ -1204,6 +1209,26 @@ gst_tensor_time_sync_set_option_data (tensor_time_sync_data * sync)
       g_strfreev (strv);
       break;
     }
+    case SYNC_REFRESH:
+    {
+      gchar **strv;
+
+      /* sink_id:timeout, wait for the base pad if timeout is not given */
+      strv = g_strsplit (sync->option ? sync->option : "", ":", 2);
+      if (strv[0] != NULL)
+        sync->data_refresh.sink_id = g_ascii_strtoull (strv[0], NULL, 10);
+      else
+        sync->data_refresh.sink_id = 0;
+
+      if (strv[1] != NULL)
+        sync->data_refresh.timeout = g_ascii_strtoull (strv[1], NULL, 10);
+      else
+        sync->data_refresh.timeout = GST_CLOCK_TIME_NONE;
+
+      sync->data_refresh.last_time = GST_CLOCK_TIME_NONE;
+      g_strfreev (strv);
+      break;
+    }
     default:
       /* unknown mode */
       GST_WARNING ("Unknown mode = %d", sync->mode);
@@ -1213,6 +1238,291 @@ gst_tensor_time_sync_set_option_data (tensor_time_sync_data * sync)
   return TRUE;
 }
 
+/**
+ * @brief Set the waiting state of the pads of collect pads for the time-sync mode.
+ */
+void
+gst_tensor_time_sync_set_pad_waiting (GstCollectPads * collect,
+    tensor_time_sync_data * sync)
+{
+  GSList *walk;
+  guint sink_id = 0;
+
+  g_return_if_fail (collect != NULL);
+  g_return_if_fail (sync != NULL);
+
+  /**
+   * Collected function is called when the waiting pads have the buffers.
+   * In refresh mode, only the base pad is waiting. If all pads were non-waiting,
+   * collect pads would call the collected function repeatedly without any buffer.
+   */
+  GST_COLLECT_PADS_STREAM_LOCK (collect);
+  for (walk = collect->data; walk; walk = g_slist_next (walk), sink_id++) {
+    gst_collect_pads_set_waiting (collect, (GstCollectData *) walk->data,
+        !gst_tensor_time_sync_is_refresh (sync) ||
+        sink_id == sync->data_refresh.sink_id);
+  }
+  GST_COLLECT_PADS_STREAM_UNLOCK (collect);
+}
+
+/**
+ * @brief Handle the latency query of the src pad in mux / merge.
+ */
+gboolean
+gst_tensor_time_sync_query_latency (GstPad * pad, GstObject * parent,
+    GstQuery * query, tensor_time_sync_data * sync)
+{
+  GstClockTime min, max;
+  gboolean live;
+
+  g_return_val_if_fail (query != NULL, FALSE);
+  g_return_val_if_fail (sync != NULL, FALSE);
+
+  /* the default handler forwards the query to all sink pads and aggregates the results */
+  if (!gst_pad_query_default (pad, parent, query))
+    return FALSE;
+
+  gst_query_parse_latency (query, &live, &min, &max);
+
+  if (live && GST_CLOCK_TIME_IS_VALID (sync->latency) && sync->latency > 0) {
+    min += sync->latency;
+    if (GST_CLOCK_TIME_IS_VALID (max))
+      max += sync->latency;
+
+    gst_query_set_latency (query, live, min, max);
+  }
+
+  GST_DEBUG_OBJECT (parent, "Latency: live %d, min %" GST_TIME_FORMAT
+      ", max %" GST_TIME_FORMAT, live, GST_TIME_ARGS (min),
+      GST_TIME_ARGS (max));
+  return TRUE;
+}
+
+/**
+ * @brief Get the collect data of the base pad.
+ */
+static GstCollectData *
+gst_tensor_time_sync_get_base_pad (GstCollectPads * collect, guint sink_id)
+{
+  GSList *walk;
+
+  walk = g_slist_nth (collect->data, sink_id);
+  if (walk == NULL) {
+    GST_ERROR_OBJECT (collect, "Cannot get GstCollectData from GSList");
+    return NULL;
+  }
+
+  return (GstCollectData *) walk->data;
+}
+
+/**
+ * @brief Get the max time to wait for the base pad (refresh mode).
+ * If the timeout is not given in the option, the latency of time sync is used.
+ */
+static GstClockTime
+gst_tensor_time_sync_get_refresh_timeout (tensor_time_sync_data * sync)
+{
+  GstClockTime timeout = sync->data_refresh.timeout;
+
+  if (!GST_CLOCK_TIME_IS_VALID (timeout) && sync->latency > 0)
+    timeout = sync->latency;
+
+  return timeout;
+}
+
+/**
+ * @brief Clip function of collect pads in mux / merge.
+ */
+gboolean
+gst_tensor_time_sync_clip (GstCollectPads * collect,
+    tensor_time_sync_data * sync, GstCollectData * data, GstBuffer * inbuf,
+    GstBuffer ** outbuf)
+{
+  tensor_sync_refresh_data *refresh;
+  GstCollectData *base;
+  GstTensorCollectPadData *pad;
+  GstClockTime timeout;
+
+  g_return_val_if_fail (outbuf != NULL, FALSE);
+
+  *outbuf = inbuf;
+
+  if (!gst_tensor_time_sync_is_refresh (sync))
+    return FALSE;
+
+  refresh = &sync->data_refresh;
+  base = gst_tensor_time_sync_get_base_pad (collect, refresh->sink_id);
+  if (base == data)
+    return FALSE;
+
+  /* keep the most recent buffer, the pad does not wait for the base pad */
+  pad = (GstTensorCollectPadData *) data;
+  if (pad->buffer != NULL)
+    gst_buffer_unref (pad->buffer);
+  pad->buffer = inbuf;
+  *outbuf = NULL;
+
+  /* the collected function makes the tensors with the queued buffer of base pad */
+  if (base == NULL || base->buffer != NULL)
+    return FALSE;
+
+  if (!GST_CLOCK_TIME_IS_VALID (refresh->last_time)) {
+    /* the base pad is received before the other pads, push the first tensors */
+    return (((GstTensorCollectPadData *) base)->buffer != NULL);
+  }
+
+  /* the base pad is stalled, push the tensors with the last buffer of base pad */
+  timeout = gst_tensor_time_sync_get_refresh_timeout (sync);
+  return (GST_CLOCK_TIME_IS_VALID (timeout) &&
+      GST_BUFFER_PTS_IS_VALID (inbuf) &&
+      GST_BUFFER_PTS (inbuf) >= refresh->last_time + timeout);
+}
+
+/**
+ * @brief Append the memories of the buffer of each pad (refresh mode).
+ * @return FALSE if a pad has never received a buffer.
+ */
+static gboolean
+gst_tensor_time_sync_append_last_buffers (GstCollectPads * collect,
+    GstBuffer * tensors_buf, GstTensorsConfig * configs)
+{
+  GSList *walk;
+  GstTensorsConfig in_configs;
+  gint old_numerator = G_MAXINT;
+  gint old_denominator = G_MAXINT;
+  guint i, counting = 0;
+
+  for (walk = collect->data; walk; walk = g_slist_next (walk)) {
+    GstTensorCollectPadData *pad = (GstTensorCollectPadData *) walk->data;
+
+    if (pad->buffer == NULL)
+      return FALSE;
+  }
+
+  for (walk = collect->data; walk; walk = g_slist_next (walk)) {
+    GstTensorCollectPadData *pad = (GstTensorCollectPadData *) walk->data;
+    GstCaps *caps = gst_pad_get_current_caps (pad->pad);
+    guint n_mem = gst_buffer_n_memory (pad->buffer);
+
+    gst_tensors_config_from_structure (&in_configs,
+        gst_caps_get_structure (caps, 0));
+    gst_caps_unref (caps);
+    g_assert (gst_tensors_config_validate (&in_configs));
+
+    if (in_configs.rate_d < old_denominator)
+      old_denominator = in_configs.rate_d;
+    if (in_configs.rate_n < old_numerator)
+      old_numerator = in_configs.rate_n;
+
+    g_assert (n_mem == in_configs.info.num_tensors);
+    g_assert ((counting + n_mem) < NNS_TENSOR_SIZE_LIMIT);
+
+    for (i = 0; i < n_mem; i++) {
+      gst_buffer_append_memory (tensors_buf,
+          gst_buffer_get_memory (pad->buffer, i));
+      configs->info.info[counting] = in_configs.info.info[i];
+      counting++;
+    }
+  }
+
+  configs->rate_d = old_denominator;
+  configs->rate_n = old_numerator;
+  return TRUE;
+}
+
+/**
+ * @brief Reset the time-sync state of the last output (e.g., state change or flush).
+ */
+void
+gst_tensor_time_sync_reset (tensor_time_sync_data * sync)
+{
+  g_return_if_fail (sync != NULL);
+
+  /* push the first tensors again in refresh mode */
+  if (sync->mode == SYNC_REFRESH)
+    sync->data_refresh.last_time = GST_CLOCK_TIME_NONE;
+}
+
+/**
+ * @brief Make tensors from the last buffer of each pad (refresh mode).
+ * The tensors are pushed when the base pad has a buffer, or the timeout from last output is expired.
+ * If the timeout is not given in the option, the latency of time sync is used.
+ * The buffers of the other pads are kept by gst_tensor_time_sync_clip() whenever the pads receive the buffers.
+ * @note The timeout is checked with the timestamps of incoming buffers (there is no timer in collect pads).
+ */
+static gboolean
+gst_tensor_time_sync_buffer_refresh (GstCollectPads * collect,
+    tensor_time_sync_data * sync, gboolean * need_buffer,
+    GstBuffer * tensors_buf, GstTensorsConfig * configs)
+{
+  tensor_sync_refresh_data *refresh = &sync->data_refresh;
+  GstCollectData *base;
+  GstTensorCollectPadData *pad;
+  GstClockTime current_time = GST_CLOCK_TIME_NONE;
+  GstClockTime latest = GST_CLOCK_TIME_NONE;
+  GstClockTime timeout;
+  GstBuffer *buf;
+  GSList *walk;
+  gboolean update = FALSE;
+
+  timeout = gst_tensor_time_sync_get_refresh_timeout (sync);
+
+  base = gst_tensor_time_sync_get_base_pad (collect, refresh->sink_id);
+  if (base == NULL)
+    return TRUE;
+
+  /* the most recent timestamp of other pads */
+  for (walk = collect->data; walk; walk = g_slist_next (walk)) {
+    GstCollectData *data = (GstCollectData *) walk->data;
+
+    pad = (GstTensorCollectPadData *) data;
+    if (data == base || pad->buffer == NULL)
+      continue;
+
+    if (!GST_CLOCK_TIME_IS_VALID (latest) ||
+        latest < GST_BUFFER_PTS (pad->buffer))
+      latest = GST_BUFFER_PTS (pad->buffer);
+  }
+
+  pad = (GstTensorCollectPadData *) base;
+  buf = gst_collect_pads_pop (collect, base);
+
+  if (buf != NULL) {
+    if (pad->buffer != NULL)
+      gst_buffer_unref (pad->buffer);
+    pad->buffer = buf;
+
+    current_time = GST_BUFFER_PTS (buf);
+    update = TRUE;
+  } else if (GST_COLLECT_PADS_STATE_IS_SET (base, GST_COLLECT_PADS_STATE_EOS)) {
+    /* end-of-stream */
+    return TRUE;
+  } else if (!GST_CLOCK_TIME_IS_VALID (refresh->last_time) &&
+      pad->buffer != NULL) {
+    /* the base pad is received before the other pads, push the first tensors */
+    current_time = GST_BUFFER_PTS (pad->buffer);
+    update = TRUE;
+  } else if (GST_CLOCK_TIME_IS_VALID (timeout) &&
+      GST_CLOCK_TIME_IS_VALID (latest) &&
+      GST_CLOCK_TIME_IS_VALID (refresh->last_time) &&
+      latest >= refresh->last_time + timeout) {
+    /* the base pad is stalled, reuse the last buffer of base pad */
+    current_time = latest;
+    update = TRUE;
+  }
+
+  if (!update ||
+      !gst_tensor_time_sync_append_last_buffers (collect, tensors_buf,
+          configs)) {
+    *need_buffer = TRUE;
+    return FALSE;
+  }
+
+  refresh->last_time = current_time;
+  GST_BUFFER_PTS (tensors_buf) = current_time;
+  return FALSE;
+}
+
 /**
  * @brief A function call to decide current timestamp among collected pads based on PTS.
  * It will decide current timestamp according to sync option.
@@ -1224,6 +1534,11 @@ gst_tensor_time_sync_get_current_time (GstCollectPads * collect,
   GSList *walk = NULL;
   guint count = 0;
 
+  if (sync->mode == SYNC_REFRESH) {
+    /* the timestamp is decided when making tensors, the other pads may not have a buffer */
+    return FALSE;
+  }
+
   walk = collect->data;
   while (walk) {
     GstCollectData *data;
@@ -1276,6 +1591,11 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
   GstClockTime base = 0;
   guint i = 0;
 
+  if (sync->mode == SYNC_REFRESH) {
+    return gst_tensor_time_sync_buffer_refresh (collect, sync, need_buffer,
+        tensors_buf, configs);
+  }
+
   walk = collect->data;
 
   if (sync->mode == SYNC_BASEPAD) {
@@ -1420,3 +1740,66 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
   /* not eos */
   return FALSE;
 }
+
+/**
+ * @brief Copy a tensor which consists of several memory blocks (e.g., tensor_merge with zero-copy) into a contiguous buffer from the pool.
+ * @param pool The pool of contiguous buffers. It is created if NULL, and created again if the size of the tensor is changed. The caller should deactivate and unref it.
+ * @param buffer The buffer with the memory blocks of a tensor
+ * @return The contiguous buffer (unref it to return to the pool), NULL if failed.
+ */
+GstBuffer *
+gst_tensor_buffer_get_contiguous (GstBufferPool ** pool, GstBuffer * buffer)
+{
+  GstBuffer *contiguous = NULL;
+  GstStructure *config;
+  GstMapInfo map;
+  gsize size;
+
+  g_return_val_if_fail (pool != NULL, NULL);
+  g_return_val_if_fail (GST_IS_BUFFER (buffer), NULL);
+
+  size = gst_buffer_get_size (buffer);
+
+  if (*pool) {
+    if (gst_buffer_pool_acquire_buffer (*pool, &contiguous, NULL) != GST_FLOW_OK)
+      return NULL;
+
+    if (gst_buffer_get_size (contiguous) != size) {
+      /* the size of the tensor is changed, drop the pool */
+      gst_buffer_unref (contiguous);
+      contiguous = NULL;
+
+      gst_buffer_pool_set_active (*pool, FALSE);
+      gst_object_unref (*pool);
+      *pool = NULL;
+    }
+  }
+
+  if (*pool == NULL) {
+    *pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (*pool);
+    gst_buffer_pool_config_set_params (config, NULL, size, 0, 0);
+
+    if (!gst_buffer_pool_set_config (*pool, config) ||
+        !gst_buffer_pool_set_active (*pool, TRUE)) {
+      GST_ERROR ("Failed to activate the pool of contiguous buffers.");
+      gst_object_unref (*pool);
+      *pool = NULL;
+      return NULL;
+    }
+  }
+
+  if (contiguous == NULL &&
+      gst_buffer_pool_acquire_buffer (*pool, &contiguous, NULL) != GST_FLOW_OK)
+    return NULL;
+
+  if (!gst_buffer_map (contiguous, &map, GST_MAP_WRITE)) {
+    gst_buffer_unref (contiguous);
+    return NULL;
+  }
+
+  gst_buffer_extract (buffer, 0, map.data, size);
+  gst_buffer_unmap (contiguous, &map);
+
+  return contiguous;
+}
@@ -61,6 +61,7 @@ typedef enum
   SYNC_NOSYNC = 0,
   SYNC_SLOWEST = 1,
   SYNC_BASEPAD = 2,
+  SYNC_REFRESH = 3,
   SYNC_END,
 } tensor_time_sync_mode;
 
@@ -72,14 +73,25 @@ typedef struct _tensor_sync_basepad_data{
   GstClockTime duration;
 } tensor_sync_basepad_data;
 
+/**
+ * @brief Tensor Merge/Mux sync data for refresh mode
+ */
+typedef struct _tensor_sync_refresh_data{
+  guint sink_id; /**< the base pad */
+  GstClockTime timeout; /**< max time to wait for the base pad (GST_CLOCK_TIME_NONE to use the latency of time sync) */
+  GstClockTime last_time; /**< the timestamp of last output */
+} tensor_sync_refresh_data;
+
 /**
  * @brief Tensor Merge/Mux time sync data
  */
 typedef struct _tensor_time_sync_data {
   tensor_time_sync_mode mode;
   gchar *option;
+  GstClockTime latency; /**< additional latency to wait for the stalled pads in live pipeline (0 for none) */
   union {
     tensor_sync_basepad_data data_basepad;
+    tensor_sync_refresh_data data_refresh;
   };
 } tensor_time_sync_data;
 
@@ -106,6 +118,46 @@ typedef struct
   gint nth;
 } GstTensorPad;
 
+/**
+ * @brief Check the time-sync mode does not wait for all pads.
+ */
+#define gst_tensor_time_sync_is_refresh(sync) ((sync)->mode == SYNC_REFRESH)
+
+/**
+ * @brief Set the waiting state of the pads of collect pads for the time-sync mode.
+ * In refresh mode, only the base pad is waiting. The other pads are non-waiting, their buffers are kept with gst_tensor_time_sync_clip().
+ * @param collect Collect pad. The pads should be added without locking the waiting state.
+ * @param sync Synchronization Option
+ */
+extern void
+gst_tensor_time_sync_set_pad_waiting (GstCollectPads * collect, tensor_time_sync_data * sync);
+
+/**
+ * @brief Clip function of collect pads in mux / merge.
+ * In refresh mode, the incoming buffer of the pads except the base pad is kept as the last buffer of the pad, instead of being queued.
+ * Thus the pads are not blocked by the base pad, and the tensors have the most recent buffer of each pad.
+ * @param collect Collect pad.
+ * @param sync Synchronization Option
+ * @param data The collect data of the pad
+ * @param inbuf The incoming buffer (the ownership is taken)
+ * @param outbuf The buffer to be queued (NULL if it is kept as the last buffer)
+ * @return TRUE if the tensors should be made now without the base pad (the first tensors, or the base pad is stalled for the timeout).
+ */
+extern gboolean
+gst_tensor_time_sync_clip (GstCollectPads * collect, tensor_time_sync_data * sync, GstCollectData * data, GstBuffer * inbuf, GstBuffer ** outbuf);
+
+/**
+ * @brief Handle the latency query of the src pad in mux / merge.
+ * The latency of upstream is aggregated from all sink pads, and the latency of time sync is added in live pipeline.
+ * @param pad The src pad.
+ * @param parent The element.
+ * @param query The latency query.
+ * @param sync Synchronization Option
+ * @return TRUE if the query is handled.
+ */
+extern gboolean
+gst_tensor_time_sync_query_latency (GstPad * pad, GstObject * parent, GstQuery * query, tensor_time_sync_data * sync);
+
 /**
  * @brief Get the corresponding mode from the string value.
  * @param[in] str The string value for the mode.
@@ -129,12 +181,19 @@ gst_tensor_time_sync_get_mode_string (tensor_time_sync_mode mode);
 extern gboolean
 gst_tensor_time_sync_set_option_data (tensor_time_sync_data * sync);
 
+/**
+ * @brief Reset the time-sync state of the last output (e.g., state change or flush).
+ * @param sync Synchronization Option
+ */
+extern void
+gst_tensor_time_sync_reset (tensor_time_sync_data * sync);
+
 /**
  * @brief A function call to decide current timestamp among collected pads based on PTS.
  * It will decide current timestamp according to sync option.
  * @return True / False. If EOS, it return TRUE.
  * @param collect Collect pad.
- * @param sync Synchronization Option (NOSYNC, SLOWEST, BASEPAD, END)
+ * @param sync Synchronization Option (NOSYNC, SLOWEST, BASEPAD, REFRESH, END)
  * @param current_time Current time
  */
 extern gboolean
@@ -145,7 +204,7 @@ gst_tensor_time_sync_get_current_time (GstCollectPads * collect, tensor_time_syn
  * It decide which buffer is going to be used according to sync option.
  * @return True / False if EOS, it return TRUE.
  * @param collect Collect pad.
- * @param sync Synchronization Option (NOSYNC, SLOWEST, BASEPAD, END)
+ * @param sync Synchronization Option (NOSYNC, SLOWEST, BASEPAD, REFRESH, END)
  * @param current_time Current Timestamp
  * @param need_buffer Boolean for Update Collect Pads
  * @param tensors_buf Generated GstBuffer for Collected Buffer
@@ -154,5 +213,14 @@ gst_tensor_time_sync_get_current_time (GstCollectPads * collect, tensor_time_syn
 extern gboolean
 gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect, tensor_time_sync_data * sync, GstClockTime current_time, gboolean * need_buffer, GstBuffer * tensors_buf, GstTensorsConfig * configs);
 
+/**
+ * @brief Copy a tensor which consists of several memory blocks (e.g., tensor_merge with zero-copy) into a contiguous buffer from the pool.
+ * @param pool The pool of contiguous buffers. It is created if NULL, and created again if the size of the tensor is changed. The caller should deactivate and unref it.
+ * @param buffer The buffer with the memory blocks of a tensor
+ * @return The contiguous buffer (unref it to return to the pool), NULL if failed.
+ */
+extern GstBuffer *
+gst_tensor_buffer_get_contiguous (GstBufferPool ** pool, GstBuffer * buffer);
+
 G_END_DECLS
 #endif /* __GST_TENSOR_COMMON_H__ */
@@ -45,6 +45,7 @@
 #include <string.h>
 #include "tensor_converter.h"
 #include "converter-media-info.h"
+#include "tensor_converter_video.h"
 
 /**
  * @brief Macro for debug mode.
@@ -99,7 +100,14 @@ enum
   PROP_INPUT_DIMENSION,
   PROP_INPUT_TYPE,
   PROP_FRAMES_PER_TENSOR,
+  PROP_FRAMES_HOP,
   PROP_SET_TIMESTAMP,
+  PROP_OUTPUT_FORMAT,
+  PROP_OUTPUT_WIDTH,
+  PROP_OUTPUT_HEIGHT,
+  PROP_OUTPUT_TYPE,
+  PROP_MEAN,
+  PROP_SCALE,
   PROP_SILENT
 };
 
@@ -118,6 +126,21 @@ enum
  */
 #define DEFAULT_FRAMES_PER_TENSOR 1
 
+/**
+ * @brief Frames to move the window of output tensor (0 for non-overlapping windows).
+ */
+#define DEFAULT_FRAMES_HOP 0
+
+/**
+ * @brief The minimum number of hops in a memory block for overlapping windows.
+ */
+#define WINDOW_MIN_HOPS_IN_BLOCK 4
+
+/**
+ * @brief Color format of output tensor when converting YUV video.
+ */
+#define DEFAULT_OUTPUT_FORMAT "RGB"
+
 #define gst_tensor_converter_parent_class parent_class
 G_DEFINE_TYPE (GstTensorConverter, gst_tensor_converter, GST_TYPE_ELEMENT);
 
@@ -205,6 +228,20 @@ gst_tensor_converter_class_init (GstTensorConverterClass * klass)
           DEFAULT_FRAMES_PER_TENSOR,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorConverter::frames-hop:
+   *
+   * The number of frames to move the window of output tensor.
+   * With the value smaller than frames-per-tensor, GstTensorConverter pushes the overlapping windows of frames
+   * (e.g., frames-per-tensor=16000 frames-hop=320 for 1 sec windows with 20 ms hop of 16 kHz audio).
+   * 0 (default) for non-overlapping windows.
+   */
+  g_object_class_install_property (object_class, PROP_FRAMES_HOP,
+      g_param_spec_uint ("frames-hop", "Frames hop",
+          "The number of frames to move the window of output tensor (0 for non-overlapping windows)",
+          0, G_MAXUINT, DEFAULT_FRAMES_HOP,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstTensorConverter::set-timestamp:
    *
@@ -215,6 +252,72 @@ gst_tensor_converter_class_init (GstTensorConverterClass * klass)
           "The flag to set timestamp when received a buffer with invalid timestamp",
           DEFAULT_SET_TIMESTAMP, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorConverter::output-format:
+   *
+   * Color format of output tensor when incoming video is YUV (NV12, I420 or YUY2).
+   * GstTensorConverter converts YUV video to RGB (or BGR) tensor directly, without videoconvert.
+   */
+  g_object_class_install_property (object_class, PROP_OUTPUT_FORMAT,
+      g_param_spec_string ("output-format", "Output format",
+          "Color format (RGB or BGR) of output tensor when converting YUV video",
+          DEFAULT_OUTPUT_FORMAT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::output-width:
+   *
+   * Width of output tensor when incoming media type is video.
+   * GstTensorConverter resizes the video frames (bilinear) without videoscale. 0 to keep the width of video.
+   */
+  g_object_class_install_property (object_class, PROP_OUTPUT_WIDTH,
+      g_param_spec_uint ("output-width", "Output width",
+          "Width of output tensor to resize the video frames (0 to keep the width)",
+          0, G_MAXINT, 0, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::output-height:
+   *
+   * Height of output tensor when incoming media type is video.
+   * GstTensorConverter resizes the video frames (bilinear) without videoscale. 0 to keep the height of video.
+   */
+  g_object_class_install_property (object_class, PROP_OUTPUT_HEIGHT,
+      g_param_spec_uint ("output-height", "Output height",
+          "Height of output tensor to resize the video frames (0 to keep the height)",
+          0, G_MAXINT, 0, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::output-type:
+   *
+   * Type of output tensor when incoming media type is video (uint8 or float32).
+   * The video frames are converted to the type without tensor_transform.
+   */
+  g_object_class_install_property (object_class, PROP_OUTPUT_TYPE,
+      g_param_spec_string ("output-type", "Output type",
+          "Type (uint8 or float32) of output tensor when converting video", "",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::mean:
+   *
+   * Mean values to normalize the video frames, output = (value - mean) * scale.
+   * One value for all channels or the values for each channel (e.g., 123.68:116.78:103.94).
+   */
+  g_object_class_install_property (object_class, PROP_MEAN,
+      g_param_spec_string ("mean", "Mean",
+          "Mean values (for all channels or each channel) to normalize the video frames",
+          "", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::scale:
+   *
+   * Scale values to normalize the video frames, output = (value - mean) * scale.
+   * One value for all channels or the values for each channel (e.g., 0.0078125).
+   */
+  g_object_class_install_property (object_class, PROP_SCALE,
+      g_param_spec_string ("scale", "Scale",
+          "Scale values (for all channels or each channel) to normalize the video frames",
+          "", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstTensorConverter::silent:
    *
@@ -290,9 +393,16 @@ gst_tensor_converter_init (GstTensorConverter * self)
   self->silent = DEFAULT_SILENT;
   self->set_timestamp = DEFAULT_SET_TIMESTAMP;
   self->frames_per_tensor = DEFAULT_FRAMES_PER_TENSOR;
+  self->frames_hop = DEFAULT_FRAMES_HOP;
+  memset (&self->window, 0, sizeof (GstTensorConverterWindow));
+  g_queue_init (&self->window.timestamps);
   self->in_media_type = _NNS_MEDIA_END;
   self->frame_size = 0;
-  self->remove_padding = FALSE;
+  self->convert_yuv = FALSE;
+  self->out_format = GST_VIDEO_FORMAT_RGB;
+  gst_video_info_init (&self->video_info);
+  memset (&self->preproc, 0, sizeof (GstTensorConverterVideoPreproc));
+  self->preproc.type = _NNS_END;
   gst_tensor_info_init (&self->tensor_info);
 
   self->adapter = gst_adapter_new ();
@@ -310,6 +420,7 @@ gst_tensor_converter_finalize (GObject * object)
   self = GST_TENSOR_CONVERTER (object);
 
   gst_tensor_converter_reset (self);
+  gst_tensor_converter_video_preproc_reset (&self->preproc);
 
   if (self->adapter) {
     g_object_unref (self->adapter);
@@ -319,6 +430,59 @@ gst_tensor_converter_finalize (GObject * object)
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+/**
+ * @brief Parse the values (e.g., 127.5 or 123.68:116.78:103.94) to normalize the video frames.
+ * @return the number of values
+ */
+static guint
+gst_tensor_converter_parse_values (const gchar * str, gfloat * values)
+{
+  gchar **strv;
+  guint i, num = 0;
+
+  if (str == NULL || *str == '\0')
+    return 0;
+
+  strv = g_strsplit_set (str, ":,", -1);
+  for (i = 0; strv[i] != NULL; i++) {
+    gchar *end = NULL;
+    gdouble val;
+
+    g_strstrip (strv[i]);
+    val = g_ascii_strtod (strv[i], &end);
+
+    if (end == strv[i] || num >= NNS_VIDEO_CHANNEL_LIMIT) {
+      GST_WARNING ("Invalid values to normalize the video frames (%s).", str);
+      num = 0;
+      break;
+    }
+
+    values[num++] = (gfloat) val;
+  }
+
+  g_strfreev (strv);
+  return num;
+}
+
+/**
+ * @brief Get the string of the values to normalize the video frames.
+ */
+static gchar *
+gst_tensor_converter_get_values_string (const gfloat * values, guint num)
+{
+  GString *str = g_string_new (NULL);
+  gchar buf[G_ASCII_DTOSTR_BUF_SIZE];
+  guint i;
+
+  for (i = 0; i < num; i++) {
+    if (i > 0)
+      g_string_append_c (str, ':');
+    g_string_append (str, g_ascii_dtostr (buf, sizeof (buf), values[i]));
+  }
+
+  return g_string_free (str, FALSE);
+}
+
 /**
  * @brief Setter for tensor_converter properties.
  */
@@ -345,10 +509,61 @@ gst_tensor_converter_set_property (GObject * object, guint prop_id,
       self->frames_per_tensor = g_value_get_uint (value);
       silent_debug ("Set frames in output = %d", self->frames_per_tensor);
       break;
+    case PROP_FRAMES_HOP:
+      self->frames_hop = g_value_get_uint (value);
+      silent_debug ("Set frames hop = %d", self->frames_hop);
+      break;
     case PROP_SET_TIMESTAMP:
       self->set_timestamp = g_value_get_boolean (value);
       silent_debug ("Set timestamp = %d", self->set_timestamp);
       break;
+    case PROP_OUTPUT_FORMAT:
+    {
+      const gchar *format = g_value_get_string (value);
+
+      if (format && g_ascii_strcasecmp (format, "BGR") == 0) {
+        self->out_format = GST_VIDEO_FORMAT_BGR;
+      } else if (format && g_ascii_strcasecmp (format, "RGB") == 0) {
+        self->out_format = GST_VIDEO_FORMAT_RGB;
+      } else {
+        GST_WARNING ("output format unknown (RGB or BGR).");
+      }
+      break;
+    }
+    case PROP_OUTPUT_WIDTH:
+      self->preproc.width = g_value_get_uint (value);
+      silent_debug ("Set output width = %u", self->preproc.width);
+      break;
+    case PROP_OUTPUT_HEIGHT:
+      self->preproc.height = g_value_get_uint (value);
+      silent_debug ("Set output height = %u", self->preproc.height);
+      break;
+    case PROP_OUTPUT_TYPE:
+    {
+      const gchar *type = g_value_get_string (value);
+
+      self->preproc.type = _NNS_END;
+      if (type && *type != '\0') {
+        self->preproc.type = gst_tensor_get_type (type);
+
+        if (self->preproc.type != _NNS_UINT8 &&
+            self->preproc.type != _NNS_FLOAT32) {
+          GST_WARNING ("output type unknown (uint8 or float32).");
+          self->preproc.type = _NNS_END;
+        }
+      }
+      break;
+    }
+    case PROP_MEAN:
+      self->preproc.num_mean =
+          gst_tensor_converter_parse_values (g_value_get_string (value),
+          self->preproc.mean);
+      break;
+    case PROP_SCALE:
+      self->preproc.num_scale =
+          gst_tensor_converter_parse_values (g_value_get_string (value),
+          self->preproc.scale);
+      break;
     case PROP_SILENT:
       self->silent = g_value_get_boolean (value);
       silent_debug ("Set silent = %d", self->silent);
@@ -390,9 +605,40 @@ gst_tensor_converter_get_property (GObject * object, guint prop_id,
     case PROP_FRAMES_PER_TENSOR:
       g_value_set_uint (value, self->frames_per_tensor);
       break;
+    case PROP_FRAMES_HOP:
+      g_value_set_uint (value, self->frames_hop);
+      break;
     case PROP_SET_TIMESTAMP:
       g_value_set_boolean (value, self->set_timestamp);
       break;
+    case PROP_OUTPUT_FORMAT:
+      g_value_set_string (value,
+          (self->out_format == GST_VIDEO_FORMAT_BGR) ? "BGR" : "RGB");
+      break;
+    case PROP_OUTPUT_WIDTH:
+      g_value_set_uint (value, self->preproc.width);
+      break;
+    case PROP_OUTPUT_HEIGHT:
+      g_value_set_uint (value, self->preproc.height);
+      break;
+    case PROP_OUTPUT_TYPE:
+      if (self->preproc.type != _NNS_END) {
+        g_value_set_string (value,
+            gst_tensor_get_type_string (self->preproc.type));
+      } else {
+        g_value_set_string (value, "");
+      }
+      break;
+    case PROP_MEAN:
+      g_value_take_string (value,
+          gst_tensor_converter_get_values_string (self->preproc.mean,
+              self->preproc.num_mean));
+      break;
+    case PROP_SCALE:
+      g_value_take_string (value,
+          gst_tensor_converter_get_values_string (self->preproc.scale,
+              self->preproc.num_scale));
+      break;
     case PROP_SILENT:
       g_value_set_boolean (value, self->silent);
       break;
@@ -521,6 +767,22 @@ gst_tensor_converter_sink_query (GstPad * pad, GstObject * parent,
       gst_query_set_accept_caps_result (query, res);
       return TRUE;
     }
+    case GST_QUERY_ALLOCATION:
+    {
+      GstCaps *caps;
+      gboolean need_pool;
+
+      gst_query_parse_allocation (query, &caps, &need_pool);
+
+      /* upstream can push the video frames with the strides in video meta */
+      if (caps && gst_caps_get_size (caps) > 0 &&
+          gst_tensor_media_type_from_structure (gst_caps_get_structure (caps,
+                  0)) == _NNS_VIDEO && is_video_supported (self)) {
+        gst_tensor_converter_video_propose_allocation (query);
+        return TRUE;
+      }
+      break;
+    }
     default:
       break;
   }
@@ -562,6 +824,217 @@ gst_tensor_converter_src_query (GstPad * pad, GstObject * parent,
   return gst_pad_query_default (pad, parent, query);
 }
 
+/**
+ * @brief Timestamps and offset of incoming buffer for overlapping windows.
+ */
+typedef struct
+{
+  guint64 offset; /**< offset in the stream (bytes) */
+  GstClockTime pts; /**< presentation timestamp */
+  GstClockTime dts; /**< decoding timestamp */
+} GstTensorConverterWindowTs;
+
+/**
+ * @brief Clear the frames and timestamps of overlapping windows.
+ */
+static void
+gst_tensor_converter_window_clear (GstTensorConverterWindow * window)
+{
+  if (window->mem) {
+    gst_memory_unref (window->mem);
+    window->mem = NULL;
+  }
+
+  window->data = NULL;
+  window->size = 0;
+  window->write_pos = window->read_pos = 0;
+  window->write_offset = window->read_offset = 0;
+
+  g_queue_foreach (&window->timestamps, (GFunc) g_free, NULL);
+  g_queue_clear (&window->timestamps);
+}
+
+/**
+ * @brief Prepare the memory block to write incoming frames.
+ * @note The frames of next window are copied into new block when the block is full.
+ */
+static gboolean
+gst_tensor_converter_window_prepare (GstTensorConverterWindow * window,
+    gsize window_size, gsize hop_size)
+{
+  GstMemory *mem;
+  guint8 *data;
+  gsize size, remain;
+
+  if (window->mem && window->write_pos < window->size)
+    return TRUE;
+
+  /* the block has the window and several hops, the copy of next window is amortized */
+  size = window_size +
+      MAX (WINDOW_MIN_HOPS_IN_BLOCK * window_size / hop_size,
+      WINDOW_MIN_HOPS_IN_BLOCK) * hop_size;
+
+  /**
+   * The data is freed when all windows shared from the block are released.
+   * The element writes the data only after the last window.
+   */
+  data = (guint8 *) g_try_malloc (size);
+  if (data == NULL)
+    return FALSE;
+
+  mem = gst_memory_new_wrapped (0, data, size, 0, size, data, g_free);
+  if (mem == NULL) {
+    g_free (data);
+    return FALSE;
+  }
+
+  remain = 0;
+  if (window->mem) {
+    remain = window->write_pos - window->read_pos;
+    if (remain > 0)
+      memcpy (data, window->data + window->read_pos, remain);
+
+    gst_memory_unref (window->mem);
+  }
+
+  window->mem = mem;
+  window->data = data;
+  window->size = size;
+  window->read_pos = 0;
+  window->write_pos = remain;
+  return TRUE;
+}
+
+/**
+ * @brief Get the timestamp of the window.
+ */
+static void
+gst_tensor_converter_window_get_timestamp (GstTensorConverter * self,
+    gsize frame_size, GstClockTime * pts, GstClockTime * dts)
+{
+  GstTensorConverterWindow *window = &self->window;
+  GstTensorConfig *config = &self->tensor_config;
+  GstTensorConverterWindowTs *ts, *next;
+  guint64 dist;
+
+  /* remove the timestamps of old buffers before the window */
+  while ((next = g_queue_peek_nth (&window->timestamps, 1)) != NULL &&
+      next->offset <= window->read_offset) {
+    g_free (g_queue_pop_head (&window->timestamps));
+  }
+
+  ts = g_queue_peek_head (&window->timestamps);
+  g_assert (ts != NULL);
+
+  *pts = ts->pts;
+  *dts = ts->dts;
+
+  /* same with adapter, update timestamp with the distance from the buffer */
+  if (config->rate_n > 0 && config->rate_d > 0) {
+    dist = window->read_offset - ts->offset;
+
+    if (GST_CLOCK_TIME_IS_VALID (*pts)) {
+      *pts += gst_util_uint64_scale (dist, config->rate_d * GST_SECOND,
+          (guint64) config->rate_n * frame_size);
+    }
+
+    if (GST_CLOCK_TIME_IS_VALID (*dts)) {
+      *dts += gst_util_uint64_scale (dist, config->rate_d * GST_SECOND,
+          (guint64) config->rate_n * frame_size);
+    }
+  }
+}
+
+/**
+ * @brief Push the overlapping windows of frames (frames-hop < frames-per-tensor).
+ * @note The incoming frames are written once, each window is a shared memory of the block without copy.
+ */
+static GstFlowReturn
+gst_tensor_converter_push_windows (GstTensorConverter * self, GstBuffer * inbuf,
+    gsize frame_size, guint frames_in)
+{
+  GstTensorConverterWindow *window = &self->window;
+  GstTensorConfig *config = &self->tensor_config;
+  GstTensorConverterWindowTs *ts;
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstClockTime duration;
+  GstMapInfo info;
+  gsize window_size, hop_size, remain, len;
+  const guint8 *src;
+
+  window_size = frame_size * self->frames_per_tensor;
+  hop_size = frame_size * self->frames_hop;
+
+  duration = GST_BUFFER_DURATION (inbuf);
+  if (config->rate_n > 0 && config->rate_d > 0) {
+    duration = gst_util_uint64_scale_int (self->frames_per_tensor *
+        config->rate_d, GST_SECOND, config->rate_n);
+  } else if (GST_CLOCK_TIME_IS_VALID (duration)) {
+    /** supposed same duration for incoming buffer */
+    duration = gst_util_uint64_scale_int (duration, self->frames_per_tensor,
+        frames_in);
+  }
+
+  ts = g_new (GstTensorConverterWindowTs, 1);
+  ts->offset = window->write_offset;
+  ts->pts = GST_BUFFER_PTS (inbuf);
+  ts->dts = GST_BUFFER_DTS (inbuf);
+  g_queue_push_tail (&window->timestamps, ts);
+
+  if (!gst_buffer_map (inbuf, &info, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Failed to map incoming buffer.");
+    gst_buffer_unref (inbuf);
+    return GST_FLOW_ERROR;
+  }
+
+  src = info.data;
+  remain = info.size;
+
+  while (remain > 0 && ret == GST_FLOW_OK) {
+    if (!gst_tensor_converter_window_prepare (window, window_size, hop_size)) {
+      GST_ERROR_OBJECT (self, "Failed to allocate memory for the windows.");
+      ret = GST_FLOW_ERROR;
+      break;
+    }
+
+    len = MIN (remain, window->size - window->write_pos);
+    memcpy (window->data + window->write_pos, src, len);
+
+    window->write_pos += len;
+    window->write_offset += len;
+    src += len;
+    remain -= len;
+
+    while (window->write_pos - window->read_pos >= window_size &&
+        ret == GST_FLOW_OK) {
+      GstBuffer *outbuf;
+      GstClockTime pts, dts;
+
+      gst_tensor_converter_window_get_timestamp (self, frame_size, &pts, &dts);
+
+      outbuf = gst_buffer_new ();
+      gst_buffer_append_memory (outbuf,
+          gst_memory_share (window->mem, window->read_pos, window_size));
+
+      /** set timestamp */
+      GST_BUFFER_PTS (outbuf) = pts;
+      GST_BUFFER_DTS (outbuf) = dts;
+      GST_BUFFER_DURATION (outbuf) = duration;
+
+      silent_debug_timestamp (outbuf);
+
+      window->read_pos += hop_size;
+      window->read_offset += hop_size;
+
+      ret = gst_pad_push (self->srcpad, outbuf);
+    }
+  }
+
+  gst_buffer_unmap (inbuf, &info);
+  gst_buffer_unref (inbuf);
+  return ret;
+}
+
 /**
  * @brief Chain function, this function does the actual processing.
  */
@@ -604,47 +1077,46 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       /** colorspace * width * height * type */
       frame_size = color * width * height * type;
 
-      /** supposed 1 frame in buffer */
-      g_assert ((buf_size / self->frame_size) == 1);
+      /** supposed 1 frame in buffer, the layout may be given in video meta */
+      if (!gst_tensor_converter_video_check_frame (&self->video_info, buf)) {
+        GST_ERROR_OBJECT (self, "Invalid video frame (buffer size %"
+            G_GSIZE_FORMAT ").", buf_size);
+        gst_buffer_unref (buf);
+        return GST_FLOW_ERROR;
+      }
       frames_in = 1;
 
-      if (self->remove_padding) {
-        GstMapInfo src_info, dest_info;
-        int d0, d1;
-        unsigned int src_idx = 0, dest_idx = 0;
-        size_t size, offset;
+      if (gst_tensor_converter_video_preproc_is_enabled (&self->preproc)) {
+        /** resize, typecast and normalize the frame in one pass */
+        inbuf = gst_tensor_converter_video_preproc (&self->preproc,
+            &self->video_info, buf, self->out_format);
 
-        inbuf = gst_buffer_new_and_alloc (frame_size);
-        gst_buffer_memset (inbuf, 0, 0, frame_size);
-
-        g_assert (gst_buffer_map (buf, &src_info, GST_MAP_READ));
-        g_assert (gst_buffer_map (inbuf, &dest_info, GST_MAP_WRITE));
+        if (inbuf == NULL) {
+          GST_ERROR_OBJECT (self, "Failed to preprocess video frame.");
+          return GST_FLOW_ERROR;
+        }
+      } else if (self->convert_yuv) {
+        /** convert YUV to RGB tensor in one pass */
+        inbuf = gst_tensor_converter_video_yuv_to_rgb (&self->video_info, buf,
+            self->out_format);
+        gst_buffer_unref (buf);
 
+        if (inbuf == NULL) {
+          GST_ERROR_OBJECT (self, "Failed to convert YUV frame.");
+          return GST_FLOW_ERROR;
+        }
+      } else {
         /**
-         * Refer: https://gstreamer.freedesktop.org/documentation/design/mediatype-video-raw.html
+         * Remove the padding at the end of rows if the stride (in video meta or caps) is larger than the row.
+         * Otherwise, push the incoming buffer.
          */
-        size = offset = color * width * type;
+        inbuf = gst_tensor_converter_video_remove_padding (&self->video_info,
+            buf);
 
-        g_assert (offset % 4);
-        if (offset % 4) {
-          offset += 4 - (offset % 4);
+        if (inbuf == NULL) {
+          GST_ERROR_OBJECT (self, "Failed to remove padding of video frame.");
+          return GST_FLOW_ERROR;
         }
-
-        for (d0 = 0; d0 < frames_in; d0++) {
-          for (d1 = 0; d1 < height; d1++) {
-            memcpy (dest_info.data + dest_idx, src_info.data + src_idx, size);
-            dest_idx += size;
-            src_idx += offset;
-          }
-        }
-
-        gst_buffer_unmap (buf, &src_info);
-        gst_buffer_unmap (inbuf, &dest_info);
-
-        /** copy timestamps */
-        gst_buffer_copy_into (inbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
-
-        gst_buffer_unref (buf);
       }
       break;
     }
@@ -762,6 +1234,12 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   /* update old timestamp */
   self->old_timestamp = GST_BUFFER_TIMESTAMP (inbuf);
 
+  if (self->frames_hop > 0 && self->frames_hop < frames_out) {
+    /** push the overlapping windows */
+    return gst_tensor_converter_push_windows (self, inbuf, frame_size,
+        frames_in);
+  }
+
   if (frames_in == frames_out) {
     silent_debug_timestamp (inbuf);
 
@@ -866,6 +1344,8 @@ gst_tensor_converter_reset (GstTensorConverter * self)
     gst_adapter_clear (self->adapter);
   }
 
+  gst_tensor_converter_window_clear (&self->window);
+
   self->tensor_configured = FALSE;
   gst_tensor_config_init (&self->tensor_config);
 
@@ -899,33 +1379,6 @@ gst_tensor_converter_get_format_list (GValue * list, ...)
   va_end (args);
 }
 
-/**
- * @brief Determine if we need zero-padding
- * @return TRUE if we need to add (or remove) stride per row from the stream data.
- */
-static gboolean
-gst_tensor_converter_video_stride (GstVideoFormat format, gint width)
-{
-  /**
-   * @todo The actual list is much longer, fill them.
-   * (read https://gstreamer.freedesktop.org/documentation/design/mediatype-video-raw.html)
-   */
-  switch (format) {
-    case GST_VIDEO_FORMAT_GRAY8:
-    case GST_VIDEO_FORMAT_RGB:
-    case GST_VIDEO_FORMAT_BGR:
-    case GST_VIDEO_FORMAT_I420:
-      if (width % 4) {
-        return TRUE;
-      }
-      break;
-    default:
-      break;
-  }
-
-  return FALSE;
-}
-
 /**
  * @brief Set the tensor config structure from video info (internal static function)
  * @param self this pointer to GstTensorConverter
@@ -961,6 +1414,10 @@ gst_tensor_converter_parse_video (GstTensorConverter * self,
       break;
     case GST_VIDEO_FORMAT_RGB:
     case GST_VIDEO_FORMAT_BGR:
+    case GST_VIDEO_FORMAT_NV12:
+    case GST_VIDEO_FORMAT_I420:
+    case GST_VIDEO_FORMAT_YUY2:
+      /* YUV video is converted to RGB (or BGR) tensor */
       config->info.type = _NNS_UINT8;
       config->info.dimension[0] = 3;
       break;
@@ -1206,7 +1663,9 @@ gst_tensor_converter_query_caps (GstTensorConverter * self, GstPad * pad,
           switch (type) {
             case _NNS_VIDEO:
               /* video caps from tensor info */
-              if (is_video_supported (self) && config.info.type == _NNS_UINT8) {
+              if (is_video_supported (self) &&
+                  config.info.type == ((self->preproc.type == _NNS_END) ?
+                      _NNS_UINT8 : self->preproc.type)) {
                 GValue supported_formats = G_VALUE_INIT;
                 gint colorspace, width, height;
 
@@ -1218,7 +1677,7 @@ gst_tensor_converter_query_caps (GstTensorConverter * self, GstPad * pad,
                     break;
                   case 3:
                     gst_tensor_converter_get_format_list (&supported_formats,
-                        "RGB", "BGR", NULL);
+                        "RGB", "BGR", "NV12", "I420", "YUY2", NULL);
                     break;
                   case 4:
                     gst_tensor_converter_get_format_list (&supported_formats,
@@ -1235,11 +1694,14 @@ gst_tensor_converter_query_caps (GstTensorConverter * self, GstPad * pad,
                 }
                 g_value_unset (&supported_formats);
 
-                if ((width = config.info.dimension[1]) > 0) {
+                /* the size of video is not fixed if the frames are resized */
+                if (self->preproc.width == 0 &&
+                    (width = config.info.dimension[1]) > 0) {
                   gst_structure_set (st, "width", G_TYPE_INT, width, NULL);
                 }
 
-                if ((height = config.info.dimension[2]) > 0) {
+                if (self->preproc.height == 0 &&
+                    (height = config.info.dimension[2]) > 0) {
                   gst_structure_set (st, "height", G_TYPE_INT, height, NULL);
                 }
 
@@ -1373,14 +1835,30 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
           return FALSE;
         }
 
+        self->video_info = info;
+        self->convert_yuv =
+            gst_tensor_converter_video_is_yuv (GST_VIDEO_INFO_FORMAT (&info));
+
+        if (gst_tensor_converter_video_preproc_is_enabled (&self->preproc)) {
+          /* update the size and type of tensor to be preprocessed */
+          if (!gst_tensor_converter_video_preproc_configure (&self->preproc,
+                  &info, &config.info)) {
+            GST_ERROR_OBJECT (self,
+                "Failed to configure preprocessing, check the output type (uint8 or float32) and the number of mean and scale values (1 or %u).",
+                config.info.dimension[0]);
+            return FALSE;
+          }
+        }
+
         /**
-         * Emit Warning if RSTRIDE = RU4 (3BPP) && Width % 4 > 0
-         * @todo Add more conditions!
+         * Emit Warning if the row stride is larger than the row (e.g., RSTRIDE = RU4 (3BPP) && Width % 4 > 0)
+         * YUV video is converted with the strides of each plane, no need to remove padding.
+         * The frames to be preprocessed are read with the strides.
          */
-        if (gst_tensor_converter_video_stride (GST_VIDEO_INFO_FORMAT (&info),
-                GST_VIDEO_INFO_WIDTH (&info))) {
-          self->remove_padding = TRUE;
-          silent_debug ("Set flag to remove padding, width = %d",
+        if (!self->convert_yuv &&
+            !gst_tensor_converter_video_preproc_is_enabled (&self->preproc) &&
+            gst_tensor_converter_video_has_padding (&info)) {
+          silent_debug ("The padding will be removed, width = %d",
               GST_VIDEO_INFO_WIDTH (&info));
 
           GST_WARNING_OBJECT (self,
@@ -1474,6 +1952,13 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
     config.info.dimension[frames_dim] = self->frames_per_tensor;
   }
 
+  if (self->frames_hop > self->frames_per_tensor) {
+    GST_ERROR_OBJECT (self,
+        "Invalid frames-hop (%u), it should not be larger than frames-per-tensor (%u).",
+        self->frames_hop, self->frames_per_tensor);
+    return FALSE;
+  }
+
   if (!gst_tensor_config_validate (&config)) {
     /** not fully configured */
     GST_ERROR_OBJECT (self, "Failed to configure tensor info.\n");
@@ -37,6 +37,8 @@
 #include <gst/gst.h>
 #include <gst/base/gstadapter.h>
 #include <tensor_common.h>
+#include "converter-media-info.h"
+#include "tensor_converter_video.h"
 
 G_BEGIN_DECLS
 
@@ -52,6 +54,24 @@ G_BEGIN_DECLS
   (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_TENSOR_CONVERTER))
 
 typedef struct _GstTensorConverter GstTensorConverter;
+
+/**
+ * @brief Data structure to push the overlapping windows of frames.
+ * The incoming frames are written once into the memory block, and the windows are shared from the block.
+ * When the block is full, the frames of next window are copied to new block.
+ */
+typedef struct
+{
+  GstMemory *mem; /**< memory block to collect the frames */
+  guint8 *data; /**< data of the memory block */
+  gsize size; /**< size of the memory block */
+  gsize write_pos; /**< offset in the block to write incoming frames */
+  gsize read_pos; /**< offset in the block of next window */
+  guint64 read_offset; /**< offset in the stream (bytes) of next window */
+  guint64 write_offset; /**< offset in the stream (bytes) of next incoming frames */
+  GQueue timestamps; /**< timestamps and offsets of incoming buffers */
+} GstTensorConverterWindow;
+
 typedef struct _GstTensorConverterClass GstTensorConverterClass;
 
 /**
@@ -67,13 +87,18 @@ struct _GstTensorConverter
   gboolean silent; /**< true to print minimized log */
   gboolean set_timestamp; /**< true to set timestamp when received a buffer with invalid timestamp */
   guint frames_per_tensor; /**< number of frames in output tensor */
+  guint frames_hop; /**< number of frames to move the window of output tensor (0 for non-overlapping windows) */
+  GstTensorConverterWindow window; /**< overlapping windows of frames */
   GstTensorInfo tensor_info; /**< data structure to get/set tensor info */
 
   GstAdapter *adapter; /**< adapt incoming media stream */
 
   media_type in_media_type; /**< incoming media type */
   gsize frame_size; /**< size of one frame */
-  gboolean remove_padding; /**< If true, zero-padding must be removed */
+  gboolean convert_yuv; /**< If true, YUV video is converted to RGB tensor */
+  GstVideoFormat out_format; /**< color format of output tensor (RGB or BGR) when converting YUV video */
+  GstVideoInfo video_info; /**< video info of incoming stream */
+  GstTensorConverterVideoPreproc preproc; /**< options to resize, typecast and normalize the video frames */
   gboolean tensor_configured; /**< True if already successfully configured tensor metadata */
   GstTensorConfig tensor_config; /**< output tensor info */
 
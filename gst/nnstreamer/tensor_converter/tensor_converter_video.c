@@ -0,0 +1,863 @@
+/**
+ * Copyright (C) 2019 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	tensor_converter_video.c
+ * @date	18 Oct 2019
+ * @brief	Functions to convert the video frames to tensors in tensor_converter
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @bug		No known bugs except for NYI items
+ *
+ * The YUV frames (NV12, I420 and YUY2) are converted to [3][width][height] tensor
+ * in one pass, without videoconvert in the pipeline.
+ *
+ * The frames can be also resized, converted to float and normalized in one pass
+ * (instead of videoscale and tensor_transform in the pipeline).
+ */
+
+#include <tensor_common.h>
+#include "tensor_converter_video.h"
+
+#ifndef NO_VIDEO
+#include <string.h>
+#include <math.h>
+#include <gst/video/video.h>
+
+#ifdef HAVE_ORC
+#include "transform-orc.h"
+#endif
+
+/**
+ * @brief The bits of fixed-point coefficients.
+ */
+#define YUV_COEFF_BITS 14
+
+/**
+ * @brief Fixed-point coefficients to convert YUV to RGB.
+ */
+typedef struct
+{
+  gint y_offset; /**< offset of luma (16 for limited range) */
+  gint cy; /**< coefficient of luma */
+  gint crv; /**< coefficient of V for red */
+  gint cgu; /**< coefficient of U for green */
+  gint cgv; /**< coefficient of V for green */
+  gint cbu; /**< coefficient of U for blue */
+} yuv_coeff;
+
+/**
+ * @brief Planes of a component in the video frame.
+ */
+typedef struct
+{
+  const guint8 *data; /**< the first pixel of the component */
+  gint stride; /**< row stride */
+  gint pstride; /**< pixel stride */
+  guint w_sub; /**< horizontal subsampling (shift) */
+  guint h_sub; /**< vertical subsampling (shift) */
+} yuv_comp;
+
+/**
+ * @brief Check the video format is YUV, which is converted to RGB tensor.
+ */
+gboolean
+gst_tensor_converter_video_is_yuv (GstVideoFormat format)
+{
+  switch (format) {
+    case GST_VIDEO_FORMAT_NV12:
+    case GST_VIDEO_FORMAT_I420:
+    case GST_VIDEO_FORMAT_YUY2:
+      return TRUE;
+    default:
+      break;
+  }
+
+  return FALSE;
+}
+
+/**
+ * @brief Get the fixed-point coefficients from the colorimetry.
+ * @note Supposed BT.601 if the color matrix is unknown.
+ */
+static void
+yuv_coeff_init (yuv_coeff * coeff, const GstVideoColorimetry * cinfo)
+{
+  gdouble kr, kb, kg, ys, cs;
+  const gdouble one = (gdouble) (1 << YUV_COEFF_BITS);
+
+  if (!gst_video_color_matrix_get_Kr_Kb (cinfo->matrix, &kr, &kb)) {
+    kr = 0.299;
+    kb = 0.114;
+  }
+
+  kg = 1.0 - kr - kb;
+
+  if (cinfo->range == GST_VIDEO_COLOR_RANGE_0_255) {
+    coeff->y_offset = 0;
+    ys = cs = 1.0;
+  } else {
+    coeff->y_offset = 16;
+    ys = 255.0 / 219.0;
+    cs = 255.0 / 224.0;
+  }
+
+  coeff->cy = (gint) lround (ys * one);
+  coeff->crv = (gint) lround (2.0 * (1.0 - kr) * cs * one);
+  coeff->cgu = (gint) lround (2.0 * kb * (1.0 - kb) / kg * cs * one);
+  coeff->cgv = (gint) lround (2.0 * kr * (1.0 - kr) / kg * cs * one);
+  coeff->cbu = (gint) lround (2.0 * (1.0 - kb) * cs * one);
+}
+
+/**
+ * @brief Get the component in the video frame.
+ */
+static void
+yuv_comp_init (yuv_comp * comp, GstVideoFrame * frame, guint idx)
+{
+  const GstVideoFormatInfo *finfo = frame->info.finfo;
+
+  comp->data = GST_VIDEO_FRAME_COMP_DATA (frame, idx);
+  comp->stride = GST_VIDEO_FRAME_COMP_STRIDE (frame, idx);
+  comp->pstride = GST_VIDEO_FRAME_COMP_PSTRIDE (frame, idx);
+  comp->w_sub = GST_VIDEO_FORMAT_INFO_W_SUB (finfo, idx);
+  comp->h_sub = GST_VIDEO_FORMAT_INFO_H_SUB (finfo, idx);
+}
+
+/**
+ * @brief Clamp the fixed-point value to 8-bit pixel.
+ */
+#define yuv_clamp(v) \
+    ((guint8) CLAMP ((v) >> YUV_COEFF_BITS, 0, 255))
+
+/**
+ * @brief Convert a row of YUV to RGB.
+ * @param r index of red in output pixel (0 for RGB, 2 for BGR)
+ * @param b index of blue in output pixel (2 for RGB, 0 for BGR)
+ */
+static inline void
+yuv_row_to_rgb (const guint8 * y_row, gint y_ps, const guint8 * u_row,
+    gint u_ps, guint u_sub, const guint8 * v_row, gint v_ps, guint v_sub,
+    guint8 * dest, gint width, const yuv_coeff * coeff, const gint r,
+    const gint b)
+{
+  const gint round = 1 << (YUV_COEFF_BITS - 1);
+  gint x;
+
+  for (x = 0; x < width; x++) {
+    gint Y = (y_row[x * y_ps] - coeff->y_offset) * coeff->cy + round;
+    gint U = u_row[(x >> u_sub) * u_ps] - 128;
+    gint V = v_row[(x >> v_sub) * v_ps] - 128;
+
+    dest[r] = yuv_clamp (Y + coeff->crv * V);
+    dest[1] = yuv_clamp (Y - coeff->cgu * U - coeff->cgv * V);
+    dest[b] = yuv_clamp (Y + coeff->cbu * U);
+    dest += 3;
+  }
+}
+
+/**
+ * @brief Convert the YUV video frame to RGB (or BGR) tensor.
+ */
+GstBuffer *
+gst_tensor_converter_video_yuv_to_rgb (GstVideoInfo * info, GstBuffer * buf,
+    GstVideoFormat out_format)
+{
+  GstVideoFrame frame;
+  GstBuffer *outbuf;
+  GstMapInfo out_info;
+  yuv_coeff coeff;
+  yuv_comp comp_y, comp_u, comp_v;
+  gint width, height, row;
+  gsize row_size;
+  guint8 *dest;
+
+  g_return_val_if_fail (info != NULL, NULL);
+  g_return_val_if_fail (gst_tensor_converter_video_is_yuv
+      (GST_VIDEO_INFO_FORMAT (info)), NULL);
+
+  width = GST_VIDEO_INFO_WIDTH (info);
+  height = GST_VIDEO_INFO_HEIGHT (info);
+  row_size = (gsize) width * 3;
+
+  /* mapping the frame uses the strides and offsets in video meta if exists */
+  if (!gst_video_frame_map (&frame, info, buf, GST_MAP_READ))
+    return NULL;
+
+  outbuf = gst_buffer_new_and_alloc (row_size * height);
+  if (!gst_buffer_map (outbuf, &out_info, GST_MAP_WRITE)) {
+    gst_video_frame_unmap (&frame);
+    gst_buffer_unref (outbuf);
+    return NULL;
+  }
+
+  yuv_coeff_init (&coeff, &GST_VIDEO_INFO_COLORIMETRY (info));
+  yuv_comp_init (&comp_y, &frame, GST_VIDEO_COMP_Y);
+  yuv_comp_init (&comp_u, &frame, GST_VIDEO_COMP_U);
+  yuv_comp_init (&comp_v, &frame, GST_VIDEO_COMP_V);
+
+  dest = out_info.data;
+
+  for (row = 0; row < height; row++) {
+    const guint8 *y_row = comp_y.data + row * comp_y.stride;
+    const guint8 *u_row = comp_u.data + (row >> comp_u.h_sub) * comp_u.stride;
+    const guint8 *v_row = comp_v.data + (row >> comp_v.h_sub) * comp_v.stride;
+
+    /* separated calls with constant order of colors, to be inlined */
+    if (out_format == GST_VIDEO_FORMAT_BGR) {
+      yuv_row_to_rgb (y_row, comp_y.pstride, u_row, comp_u.pstride,
+          comp_u.w_sub, v_row, comp_v.pstride, comp_v.w_sub, dest, width,
+          &coeff, 2, 0);
+    } else {
+      yuv_row_to_rgb (y_row, comp_y.pstride, u_row, comp_u.pstride,
+          comp_u.w_sub, v_row, comp_v.pstride, comp_v.w_sub, dest, width,
+          &coeff, 0, 2);
+    }
+
+    dest += row_size;
+  }
+
+  gst_buffer_unmap (outbuf, &out_info);
+  gst_video_frame_unmap (&frame);
+
+  /* copy timestamps */
+  gst_buffer_copy_into (outbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+  return outbuf;
+}
+
+/**
+ * @brief Get the size of a row in tensor (packed video format).
+ */
+static gsize
+video_row_size (GstVideoInfo * info)
+{
+  return (gsize) GST_VIDEO_INFO_WIDTH (info) *
+      GST_VIDEO_FORMAT_INFO_PSTRIDE (info->finfo, 0);
+}
+
+/**
+ * @brief Check the default layout of the video has padding at the end of rows.
+ */
+gboolean
+gst_tensor_converter_video_has_padding (GstVideoInfo * info)
+{
+  g_return_val_if_fail (info != NULL, FALSE);
+
+  return ((gsize) GST_VIDEO_INFO_PLANE_STRIDE (info, 0) !=
+      video_row_size (info));
+}
+
+/**
+ * @brief Check the buffer has a whole video frame.
+ */
+gboolean
+gst_tensor_converter_video_check_frame (GstVideoInfo * info, GstBuffer * buf)
+{
+  const GstVideoFormatInfo *finfo;
+  GstVideoMeta *meta;
+  gsize buf_size, row_size, plane_end;
+  guint i, rows;
+
+  g_return_val_if_fail (info != NULL, FALSE);
+  g_return_val_if_fail (buf != NULL, FALSE);
+
+  buf_size = gst_buffer_get_size (buf);
+  meta = gst_buffer_get_video_meta (buf);
+
+  if (meta == NULL) {
+    /* the default layout from caps */
+    return (buf_size >= GST_VIDEO_INFO_SIZE (info));
+  }
+
+  if (meta->format != GST_VIDEO_INFO_FORMAT (info) ||
+      meta->width != (guint) GST_VIDEO_INFO_WIDTH (info) ||
+      meta->height != (guint) GST_VIDEO_INFO_HEIGHT (info) ||
+      meta->n_planes != GST_VIDEO_INFO_N_PLANES (info)) {
+    return FALSE;
+  }
+
+  finfo = info->finfo;
+
+  /**
+   * The layout in video meta may be smaller (tight stride) or larger (e.g., cropped frame) than the default layout.
+   * Check each plane is in the buffer. (the plane index is same as the component index in supported formats)
+   */
+  for (i = 0; i < meta->n_planes; i++) {
+    rows = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, i,
+        GST_VIDEO_INFO_HEIGHT (info));
+    row_size = (gsize) GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (finfo, i,
+        GST_VIDEO_INFO_WIDTH (info)) * GST_VIDEO_FORMAT_INFO_PSTRIDE (finfo, i);
+
+    if (meta->stride[i] <= 0 || (gsize) meta->stride[i] < row_size)
+      return FALSE;
+
+    if (rows == 0)
+      continue;
+
+    plane_end = meta->offset[i] + (gsize) meta->stride[i] * (rows - 1) +
+        row_size;
+    if (plane_end > buf_size)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Get the video frame without padding.
+ */
+GstBuffer *
+gst_tensor_converter_video_remove_padding (GstVideoInfo * info, GstBuffer * buf)
+{
+  GstVideoMeta *meta;
+  GstVideoFrame frame;
+  GstBuffer *outbuf;
+  GstMapInfo out_info;
+  gsize offset, row_size, frame_size;
+  gint stride, height, row;
+  const guint8 *src;
+  guint8 *dest;
+
+  g_return_val_if_fail (info != NULL, NULL);
+  g_return_val_if_fail (buf != NULL, NULL);
+
+  height = GST_VIDEO_INFO_HEIGHT (info);
+  row_size = video_row_size (info);
+  frame_size = row_size * height;
+
+  /* the layout of the buffer in video meta, or the default layout from caps */
+  meta = gst_buffer_get_video_meta (buf);
+  if (meta) {
+    offset = meta->offset[0];
+    stride = meta->stride[0];
+  } else {
+    offset = GST_VIDEO_INFO_PLANE_OFFSET (info, 0);
+    stride = GST_VIDEO_INFO_PLANE_STRIDE (info, 0);
+  }
+
+  if ((gsize) stride == row_size && offset == 0 &&
+      gst_buffer_get_size (buf) == frame_size) {
+    /* no padding, push the incoming buffer */
+    return buf;
+  }
+
+  if (!gst_video_frame_map (&frame, info, buf, GST_MAP_READ)) {
+    gst_buffer_unref (buf);
+    return NULL;
+  }
+
+  /* the memory is entirely overwritten, do not fill it */
+  outbuf = gst_buffer_new_allocate (NULL, frame_size, NULL);
+  if (!outbuf || !gst_buffer_map (outbuf, &out_info, GST_MAP_WRITE)) {
+    gst_video_frame_unmap (&frame);
+    gst_buffer_unref (buf);
+    if (outbuf)
+      gst_buffer_unref (outbuf);
+    return NULL;
+  }
+
+  src = GST_VIDEO_FRAME_PLANE_DATA (&frame, 0);
+  stride = GST_VIDEO_FRAME_PLANE_STRIDE (&frame, 0);
+  dest = out_info.data;
+
+  /**
+   * Refer: https://gstreamer.freedesktop.org/documentation/design/mediatype-video-raw.html
+   */
+  if ((gsize) stride == row_size) {
+    /* only the offset is different, copy the frame at once */
+    memcpy (dest, src, frame_size);
+  } else {
+    for (row = 0; row < height; row++) {
+      memcpy (dest, src, row_size);
+      dest += row_size;
+      src += stride;
+    }
+  }
+
+  gst_buffer_unmap (outbuf, &out_info);
+  gst_video_frame_unmap (&frame);
+
+  /* copy timestamps */
+  gst_buffer_copy_into (outbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+  gst_buffer_unref (buf);
+  return outbuf;
+}
+
+/**
+ * @brief Add the metas in allocation query, which tensor_converter can handle.
+ */
+void
+gst_tensor_converter_video_propose_allocation (GstQuery * query)
+{
+  g_return_if_fail (query != NULL);
+
+  gst_query_add_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
+}
+
+/**
+ * @brief The max number of threads to preprocess a video frame.
+ */
+#define PREPROC_MAX_THREADS 4
+
+/**
+ * @brief The min number of output pixels for a thread to preprocess a video frame.
+ */
+#define PREPROC_MIN_PIXELS_PER_THREAD (128 * 128)
+
+/**
+ * @brief Private data to preprocess the video frames.
+ * @note The tables of a row are computed for each element (width x channel) to process the rows with simple loops.
+ */
+typedef struct
+{
+  guint channel; /**< the number of channels */
+  guint in_width; /**< width of incoming video */
+  guint in_height; /**< height of incoming video */
+  guint out_width; /**< width of output tensor */
+  guint out_height; /**< height of output tensor */
+  tensor_type type; /**< type of output tensor */
+  gsize row_elements; /**< the number of elements in a row of output tensor */
+
+  guint *x_src0; /**< the index of left element in the row of input */
+  guint *x_src1; /**< the index of right element in the row of input */
+  gfloat *x_weight; /**< the weight of right element */
+  guint *y_src0; /**< the index of upper row */
+  guint *y_src1; /**< the index of lower row */
+  gfloat *y_weight; /**< the weight of lower row */
+  gfloat *scale; /**< the scale of each element */
+  gfloat *bias; /**< the bias of each element (-mean x scale) */
+
+  gfloat *rows; /**< the rows to be processed (3 rows for each thread) */
+
+  guint num_threads; /**< the number of threads to process the rows */
+  GThreadPool *pool; /**< the thread pool to process the rows */
+  GMutex lock; /**< the lock for the jobs */
+  GCond cond; /**< the condition to wait for the jobs */
+  guint pending; /**< the number of pending jobs */
+
+  const guint8 *src; /**< the first row of current frame */
+  gint stride; /**< the row stride of current frame */
+  guint8 *dest; /**< the output tensor of current frame */
+} preproc_priv;
+
+/**
+ * @brief Get the bilinear coefficients (half-pixel centers) of a direction.
+ */
+static void
+preproc_coeff_init (guint in_size, guint out_size, guint idx, guint * src0,
+    guint * src1, gfloat * weight)
+{
+  gdouble scale = (gdouble) in_size / out_size;
+  gdouble pos = (idx + 0.5) * scale - 0.5;
+  guint p0;
+
+  if (pos < 0.0)
+    pos = 0.0;
+
+  p0 = (guint) floor (pos);
+  if (p0 >= in_size - 1) {
+    *src0 = *src1 = in_size - 1;
+    *weight = 0.0f;
+  } else {
+    *src0 = p0;
+    *src1 = p0 + 1;
+    *weight = (gfloat) (pos - p0);
+  }
+}
+
+/**
+ * @brief Interpolate a row of incoming frame horizontally.
+ */
+static void
+preproc_interpolate_row (preproc_priv * priv, const guint8 * src, gfloat * row)
+{
+  gsize i;
+
+  if (priv->in_width == priv->out_width) {
+#ifdef HAVE_ORC
+    nns_orc_conv_u8_to_f32 (row, src, priv->row_elements);
+#else
+    for (i = 0; i < priv->row_elements; i++)
+      row[i] = (gfloat) src[i];
+#endif
+    return;
+  }
+
+  for (i = 0; i < priv->row_elements; i++) {
+    const gfloat a = (gfloat) src[priv->x_src0[i]];
+    const gfloat b = (gfloat) src[priv->x_src1[i]];
+
+    row[i] = a + (b - a) * priv->x_weight[i];
+  }
+}
+
+/**
+ * @brief Blend the rows vertically and normalize the elements.
+ */
+static void
+preproc_blend_row (preproc_priv * priv, const gfloat * row0,
+    const gfloat * row1, gfloat weight, gfloat * out)
+{
+#ifdef HAVE_ORC
+  nns_orc_blend_norm_f32 (out, row0, row1, priv->scale, priv->bias, weight,
+      priv->row_elements);
+#else
+  gsize i;
+
+  for (i = 0; i < priv->row_elements; i++) {
+    const gfloat v = row0[i] + (row1[i] - row0[i]) * weight;
+
+    out[i] = v * priv->scale[i] + priv->bias[i];
+  }
+#endif
+}
+
+/**
+ * @brief Process a part of the rows of output tensor.
+ * @note The interpolated rows of input are reused for the next row of output.
+ */
+static void
+preproc_run_job (preproc_priv * priv, guint job)
+{
+  guint chunk = (priv->out_height + priv->num_threads - 1) / priv->num_threads;
+  guint start = job * chunk;
+  guint end = MIN (start + chunk, priv->out_height);
+  gsize n = priv->row_elements;
+  gfloat *row0, *row1, *out, *tmp;
+  gint cached0 = -1, cached1 = -1;
+  guint y;
+
+  row0 = priv->rows + job * 3 * n;
+  row1 = row0 + n;
+  out = row1 + n;
+
+  for (y = start; y < end; y++) {
+    const gint y0 = (gint) priv->y_src0[y];
+    const gint y1 = (gint) priv->y_src1[y];
+    gfloat *dest;
+
+    if (cached0 != y0) {
+      if (cached1 == y0) {
+        tmp = row0;
+        row0 = row1;
+        row1 = tmp;
+        cached1 = cached0;
+      } else {
+        preproc_interpolate_row (priv, priv->src + y0 * priv->stride, row0);
+      }
+      cached0 = y0;
+    }
+
+    if (y1 != y0 && cached1 != y1) {
+      preproc_interpolate_row (priv, priv->src + y1 * priv->stride, row1);
+      cached1 = y1;
+    }
+
+    if (priv->type == _NNS_FLOAT32)
+      dest = ((gfloat *) priv->dest) + y * n;
+    else
+      dest = out;
+
+    preproc_blend_row (priv, row0, (y1 != y0) ? row1 : row0,
+        priv->y_weight[y], dest);
+
+    if (priv->type == _NNS_UINT8) {
+      guint8 *dest_u8 = priv->dest + y * n;
+      gsize i;
+
+      for (i = 0; i < n; i++) {
+        const gfloat v = out[i] + 0.5f;
+
+        dest_u8[i] = (v <= 0.0f) ? 0 : ((v >= 255.0f) ? 255 : (guint8) v);
+      }
+    }
+  }
+}
+
+/**
+ * @brief The function of thread pool.
+ */
+static void
+preproc_thread_func (gpointer job, gpointer user_data)
+{
+  preproc_priv *priv = user_data;
+
+  preproc_run_job (priv, GPOINTER_TO_UINT (job));
+
+  g_mutex_lock (&priv->lock);
+  priv->pending--;
+  g_cond_signal (&priv->cond);
+  g_mutex_unlock (&priv->lock);
+}
+
+/**
+ * @brief Process the rows of current frame with the threads.
+ */
+static void
+preproc_run (preproc_priv * priv)
+{
+  guint job;
+
+  if (priv->pool == NULL) {
+    preproc_run_job (priv, 0);
+    return;
+  }
+
+  g_mutex_lock (&priv->lock);
+  priv->pending = priv->num_threads - 1;
+  g_mutex_unlock (&priv->lock);
+
+  /* job index starts from 1, the caller processes the first part */
+  for (job = 1; job < priv->num_threads; job++)
+    g_thread_pool_push (priv->pool, GUINT_TO_POINTER (job), NULL);
+
+  preproc_run_job (priv, 0);
+
+  g_mutex_lock (&priv->lock);
+  while (priv->pending > 0)
+    g_cond_wait (&priv->cond, &priv->lock);
+  g_mutex_unlock (&priv->lock);
+}
+
+/**
+ * @brief Check the options to preprocess the video frames are given.
+ */
+gboolean
+gst_tensor_converter_video_preproc_is_enabled (GstTensorConverterVideoPreproc *
+    preproc)
+{
+  g_return_val_if_fail (preproc != NULL, FALSE);
+
+  return (preproc->width > 0 || preproc->height > 0 ||
+      preproc->type != _NNS_END || preproc->num_mean > 0 ||
+      preproc->num_scale > 0);
+}
+
+/**
+ * @brief Configure the preprocessing and update the tensor info.
+ */
+gboolean
+gst_tensor_converter_video_preproc_configure (GstTensorConverterVideoPreproc *
+    preproc, GstVideoInfo * info, GstTensorInfo * tensor)
+{
+  preproc_priv *priv;
+  tensor_type type;
+  guint c, i, x, pixels;
+  gsize n;
+
+  g_return_val_if_fail (preproc != NULL, FALSE);
+  g_return_val_if_fail (info != NULL, FALSE);
+  g_return_val_if_fail (tensor != NULL, FALSE);
+
+  gst_tensor_converter_video_preproc_reset (preproc);
+
+  c = tensor->dimension[0];
+  if (c == 0 || c > NNS_VIDEO_CHANNEL_LIMIT || tensor->type != _NNS_UINT8)
+    return FALSE;
+
+  /* mean and scale for all channels or each channel */
+  if ((preproc->num_mean > 1 && preproc->num_mean != c) ||
+      (preproc->num_scale > 1 && preproc->num_scale != c))
+    return FALSE;
+
+  type = (preproc->type == _NNS_END) ? _NNS_UINT8 : preproc->type;
+  if (type != _NNS_UINT8 && type != _NNS_FLOAT32)
+    return FALSE;
+
+  priv = g_new0 (preproc_priv, 1);
+  priv->channel = c;
+  priv->in_width = GST_VIDEO_INFO_WIDTH (info);
+  priv->in_height = GST_VIDEO_INFO_HEIGHT (info);
+  priv->out_width = (preproc->width > 0) ? preproc->width : priv->in_width;
+  priv->out_height = (preproc->height > 0) ? preproc->height : priv->in_height;
+  priv->type = type;
+  priv->row_elements = n = (gsize) priv->out_width * c;
+
+  priv->x_src0 = g_new (guint, n);
+  priv->x_src1 = g_new (guint, n);
+  priv->x_weight = g_new (gfloat, n);
+  priv->scale = g_new (gfloat, n);
+  priv->bias = g_new (gfloat, n);
+
+  for (x = 0; x < priv->out_width; x++) {
+    guint src0, src1;
+    gfloat weight;
+
+    preproc_coeff_init (priv->in_width, priv->out_width, x, &src0, &src1,
+        &weight);
+
+    for (i = 0; i < c; i++) {
+      const gsize idx = (gsize) x * c + i;
+      gfloat mean, scale;
+
+      mean = (preproc->num_mean == 0) ? 0.0f :
+          preproc->mean[(preproc->num_mean == 1) ? 0 : i];
+      scale = (preproc->num_scale == 0) ? 1.0f :
+          preproc->scale[(preproc->num_scale == 1) ? 0 : i];
+
+      priv->x_src0[idx] = src0 * c + i;
+      priv->x_src1[idx] = src1 * c + i;
+      priv->x_weight[idx] = weight;
+      priv->scale[idx] = scale;
+      priv->bias[idx] = -mean * scale;
+    }
+  }
+
+  priv->y_src0 = g_new (guint, priv->out_height);
+  priv->y_src1 = g_new (guint, priv->out_height);
+  priv->y_weight = g_new (gfloat, priv->out_height);
+
+  for (i = 0; i < priv->out_height; i++) {
+    preproc_coeff_init (priv->in_height, priv->out_height, i,
+        &priv->y_src0[i], &priv->y_src1[i], &priv->y_weight[i]);
+  }
+
+  /* split the rows of large frame */
+  pixels = priv->out_width * priv->out_height;
+  priv->num_threads = MIN (g_get_num_processors (), PREPROC_MAX_THREADS);
+  priv->num_threads = MIN (priv->num_threads,
+      pixels / PREPROC_MIN_PIXELS_PER_THREAD);
+  priv->num_threads = MIN (priv->num_threads, priv->out_height);
+  if (priv->num_threads == 0)
+    priv->num_threads = 1;
+
+  g_mutex_init (&priv->lock);
+  g_cond_init (&priv->cond);
+
+  if (priv->num_threads > 1) {
+    priv->pool = g_thread_pool_new (preproc_thread_func, priv,
+        priv->num_threads - 1, TRUE, NULL);
+    if (priv->pool == NULL)
+      priv->num_threads = 1;
+  }
+
+  priv->rows = g_new (gfloat, priv->num_threads * 3 * n);
+
+  preproc->priv = priv;
+
+  tensor->dimension[1] = priv->out_width;
+  tensor->dimension[2] = priv->out_height;
+  tensor->type = type;
+  return TRUE;
+}
+
+/**
+ * @brief Preprocess the video frame (resize, typecast and normalization) in one pass.
+ */
+GstBuffer *
+gst_tensor_converter_video_preproc (GstTensorConverterVideoPreproc * preproc,
+    GstVideoInfo * info, GstBuffer * buf, GstVideoFormat out_format)
+{
+  preproc_priv *priv;
+  GstVideoFrame frame;
+  GstMapInfo in_info, out_info;
+  GstBuffer *outbuf;
+  gboolean is_yuv;
+  gsize out_size;
+
+  g_return_val_if_fail (preproc != NULL && preproc->priv != NULL, NULL);
+  g_return_val_if_fail (info != NULL, NULL);
+  g_return_val_if_fail (buf != NULL, NULL);
+
+  priv = preproc->priv;
+  is_yuv = gst_tensor_converter_video_is_yuv (GST_VIDEO_INFO_FORMAT (info));
+
+  if (is_yuv) {
+    /* YUV frame is converted to packed RGB, then processed */
+    outbuf = gst_tensor_converter_video_yuv_to_rgb (info, buf, out_format);
+    gst_buffer_unref (buf);
+
+    if (outbuf == NULL)
+      return NULL;
+
+    buf = outbuf;
+    if (!gst_buffer_map (buf, &in_info, GST_MAP_READ)) {
+      gst_buffer_unref (buf);
+      return NULL;
+    }
+
+    priv->src = in_info.data;
+    priv->stride = priv->in_width * priv->channel;
+  } else {
+    /* mapping the frame uses the strides and offsets in video meta if exists */
+    if (!gst_video_frame_map (&frame, info, buf, GST_MAP_READ)) {
+      gst_buffer_unref (buf);
+      return NULL;
+    }
+
+    priv->src = GST_VIDEO_FRAME_PLANE_DATA (&frame, 0);
+    priv->stride = GST_VIDEO_FRAME_PLANE_STRIDE (&frame, 0);
+  }
+
+  out_size = priv->row_elements * priv->out_height *
+      gst_tensor_get_element_size (priv->type);
+
+  /* the memory is entirely overwritten, do not fill it */
+  outbuf = gst_buffer_new_allocate (NULL, out_size, NULL);
+  if (outbuf && gst_buffer_map (outbuf, &out_info, GST_MAP_WRITE)) {
+    priv->dest = out_info.data;
+    preproc_run (priv);
+    gst_buffer_unmap (outbuf, &out_info);
+
+    /* copy timestamps */
+    gst_buffer_copy_into (outbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+  } else if (outbuf) {
+    gst_buffer_unref (outbuf);
+    outbuf = NULL;
+  }
+
+  if (is_yuv)
+    gst_buffer_unmap (buf, &in_info);
+  else
+    gst_video_frame_unmap (&frame);
+
+  priv->src = priv->dest = NULL;
+  gst_buffer_unref (buf);
+  return outbuf;
+}
+
+/**
+ * @brief Free the private data (coefficients and threads) to preprocess the video frames.
+ */
+void
+gst_tensor_converter_video_preproc_reset (GstTensorConverterVideoPreproc *
+    preproc)
+{
+  preproc_priv *priv;
+
+  g_return_if_fail (preproc != NULL);
+
+  priv = preproc->priv;
+  if (priv == NULL)
+    return;
+
+  if (priv->pool)
+    g_thread_pool_free (priv->pool, FALSE, TRUE);
+
+  g_mutex_clear (&priv->lock);
+  g_cond_clear (&priv->cond);
+
+  g_free (priv->x_src0);
+  g_free (priv->x_src1);
+  g_free (priv->x_weight);
+  g_free (priv->y_src0);
+  g_free (priv->y_src1);
+  g_free (priv->y_weight);
+  g_free (priv->scale);
+  g_free (priv->bias);
+  g_free (priv->rows);
+  g_free (priv);
+
+  preproc->priv = NULL;
+}
+#endif /* NO_VIDEO */
@@ -0,0 +1,162 @@
+/**
+ * Copyright (C) 2019 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	tensor_converter_video.h
+ * @date	18 Oct 2019
+ * @brief	Functions to convert the video frames to tensors in tensor_converter
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+#ifndef __GST_TENSOR_CONVERTER_VIDEO_H__
+#define __GST_TENSOR_CONVERTER_VIDEO_H__
+
+#include <gst/gst.h>
+#include <tensor_typedef.h>
+#include "converter-media-info.h"
+
+G_BEGIN_DECLS
+
+/**
+ * @brief The max number of channels of the video tensor.
+ */
+#define NNS_VIDEO_CHANNEL_LIMIT (4)
+
+/**
+ * @brief Options to preprocess the video frames in tensor_converter.
+ * The frame is resized (bilinear), converted to the output type and normalized ((value - mean) * scale) in one pass.
+ */
+typedef struct
+{
+  guint width; /**< width of output tensor, 0 to keep the width of video */
+  guint height; /**< height of output tensor, 0 to keep the height of video */
+  tensor_type type; /**< type of output tensor (uint8 or float32), _NNS_END to keep the type of video (uint8) */
+  guint num_mean; /**< the number of mean values (0, 1 for all channels, or the number of channels) */
+  gfloat mean[NNS_VIDEO_CHANNEL_LIMIT]; /**< mean values to be subtracted */
+  guint num_scale; /**< the number of scale values (0, 1 for all channels, or the number of channels) */
+  gfloat scale[NNS_VIDEO_CHANNEL_LIMIT]; /**< scale values to be multiplied after subtracting mean */
+
+  gpointer priv; /**< private data to process the frames (coefficients and threads) */
+} GstTensorConverterVideoPreproc;
+
+#ifndef NO_VIDEO
+/**
+ * @brief Check the video format is YUV, which is converted to RGB tensor.
+ * @param format video format
+ * @return TRUE if the format is converted to RGB
+ */
+extern gboolean
+gst_tensor_converter_video_is_yuv (GstVideoFormat format);
+
+/**
+ * @brief Convert the YUV video frame to RGB (or BGR) tensor.
+ * @param info video info of incoming buffer
+ * @param buf incoming buffer (the video frame)
+ * @param out_format the color order of output tensor (GST_VIDEO_FORMAT_RGB or GST_VIDEO_FORMAT_BGR)
+ * @return newly allocated buffer with RGB tensor, NULL if failed to convert the frame.
+ */
+extern GstBuffer *
+gst_tensor_converter_video_yuv_to_rgb (GstVideoInfo * info, GstBuffer * buf,
+    GstVideoFormat out_format);
+
+/**
+ * @brief Check the default layout of the video has padding at the end of rows.
+ * @param info video info of incoming stream
+ * @return TRUE if the row stride is larger than the row of tensor
+ */
+extern gboolean
+gst_tensor_converter_video_has_padding (GstVideoInfo * info);
+
+/**
+ * @brief Check the buffer has a whole video frame.
+ * @param info video info of incoming stream
+ * @param buf incoming buffer (the video frame)
+ * @return TRUE if all planes of the frame are in the buffer
+ * @note The strides and offsets in video meta are used if the buffer has it, the buffer may be smaller or larger than the default layout.
+ */
+extern gboolean
+gst_tensor_converter_video_check_frame (GstVideoInfo * info, GstBuffer * buf);
+
+/**
+ * @brief Get the video frame without padding.
+ * @param info video info of incoming stream
+ * @param buf incoming buffer (the video frame), this function takes the ownership.
+ * @return buf itself if the frame has no padding, or newly allocated buffer without padding. NULL if failed to map the frame.
+ * @note The strides and offset in video meta are used if the buffer has it.
+ */
+extern GstBuffer *
+gst_tensor_converter_video_remove_padding (GstVideoInfo * info, GstBuffer * buf);
+
+/**
+ * @brief Add the metas in allocation query, which tensor_converter can handle.
+ * @param query allocation query from upstream
+ * @note tensor_converter removes the padding with the strides in video meta. Upstream can push the frames in its own layout.
+ */
+extern void
+gst_tensor_converter_video_propose_allocation (GstQuery * query);
+
+/**
+ * @brief Check the options to preprocess the video frames are given.
+ * @param preproc the options to preprocess the video frames
+ * @return TRUE if the frames should be preprocessed
+ */
+extern gboolean
+gst_tensor_converter_video_preproc_is_enabled (GstTensorConverterVideoPreproc * preproc);
+
+/**
+ * @brief Configure the preprocessing and update the tensor info.
+ * @param preproc the options to preprocess the video frames
+ * @param info video info of incoming stream
+ * @param tensor tensor info ([C][W][H][N] uint8) from the video info, width, height and type will be updated.
+ * @return TRUE if successfully configured
+ */
+extern gboolean
+gst_tensor_converter_video_preproc_configure (GstTensorConverterVideoPreproc * preproc,
+    GstVideoInfo * info, GstTensorInfo * tensor);
+
+/**
+ * @brief Preprocess the video frame (resize, typecast and normalization) in one pass.
+ * @param preproc the options to preprocess the video frames (configured)
+ * @param info video info of incoming stream
+ * @param buf incoming buffer (the video frame), this function takes the ownership.
+ * @param out_format the color order of output tensor (GST_VIDEO_FORMAT_RGB or GST_VIDEO_FORMAT_BGR) when converting YUV video
+ * @return newly allocated buffer with the tensor, NULL if failed to process the frame.
+ */
+extern GstBuffer *
+gst_tensor_converter_video_preproc (GstTensorConverterVideoPreproc * preproc,
+    GstVideoInfo * info, GstBuffer * buf, GstVideoFormat out_format);
+
+/**
+ * @brief Free the private data (coefficients and threads) to preprocess the video frames.
+ * @param preproc the options to preprocess the video frames
+ */
+extern void
+gst_tensor_converter_video_preproc_reset (GstTensorConverterVideoPreproc * preproc);
+#else
+#define gst_tensor_converter_video_is_yuv(...) FALSE
+#define gst_tensor_converter_video_yuv_to_rgb(...) NULL
+#define gst_tensor_converter_video_has_padding(...) FALSE
+#define gst_tensor_converter_video_check_frame(...) FALSE
+#define gst_tensor_converter_video_remove_padding(i,b) (b)
+#define gst_tensor_converter_video_propose_allocation(...)
+#define gst_tensor_converter_video_preproc_is_enabled(...) FALSE
+#define gst_tensor_converter_video_preproc_configure(...) FALSE
+#define gst_tensor_converter_video_preproc(...) NULL
+#define gst_tensor_converter_video_preproc_reset(...)
+#endif /* NO_VIDEO */
+
+G_END_DECLS
+
+#endif /* __GST_TENSOR_CONVERTER_VIDEO_H__ */
@@ -402,6 +402,7 @@ gst_tensordec_init (GstTensorDec * self)
   self->negotiated = FALSE;
   self->decoder = NULL;
   self->plugin_data = NULL;
+  self->contiguous_pool = NULL;
 
   for (i = 0; i < TensorDecMaxOpNum; i++)
     self->option[i] = NULL;
@@ -607,6 +608,12 @@ gst_tensordec_class_finalize (GObject * object)
     g_free (self->option[i]);
   }
 
+  if (self->contiguous_pool) {
+    gst_buffer_pool_set_active (self->contiguous_pool, FALSE);
+    gst_object_unref (self->contiguous_pool);
+    self->contiguous_pool = NULL;
+  }
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -668,13 +675,39 @@ gst_tensordec_transform (GstBaseTransform * trans,
     GstMemory *in_mem[NNS_TENSOR_SIZE_LIMIT];
     GstMapInfo in_info[NNS_TENSOR_SIZE_LIMIT];
     GstTensorMemory input[NNS_TENSOR_SIZE_LIMIT];
-    guint i, num_tensors;
+    GstBuffer *contiguous = NULL;
+    guint i, num_tensors, n_mem;
 
     num_tensors = self->tensor_config.info.num_tensors;
-    g_assert (gst_buffer_n_memory (inbuf) == num_tensors);
+    n_mem = gst_buffer_n_memory (inbuf);
+
+    /**
+     * A single tensor may consist of several memory blocks
+     * (e.g., tensor_merge with zero-copy), map it as one block.
+     */
+    if (n_mem != num_tensors && (num_tensors != 1 || n_mem == 0)) {
+      GST_ELEMENT_ERROR (self, STREAM, FORMAT, (NULL),
+          ("the number of memory blocks (%u) does not match the number of tensors (%u)",
+              n_mem, num_tensors));
+      return GST_FLOW_ERROR;
+    }
+
+    if (n_mem != num_tensors) {
+      /* copy the memory blocks into a buffer from the pool, not to allocate a new block for each frame */
+      contiguous = gst_tensor_buffer_get_contiguous (&self->contiguous_pool,
+          inbuf);
+      if (contiguous == NULL) {
+        GST_ELEMENT_ERROR (self, RESOURCE, FAILED, (NULL),
+            ("failed to get a contiguous buffer for the input tensor"));
+        return GST_FLOW_ERROR;
+      }
+    }
 
     for (i = 0; i < num_tensors; i++) {
-      in_mem[i] = gst_buffer_peek_memory (inbuf, i);
+      if (contiguous)
+        in_mem[i] = gst_buffer_get_memory (contiguous, 0);
+      else
+        in_mem[i] = gst_buffer_get_memory (inbuf, i);
       g_assert (gst_memory_map (in_mem[i], &in_info[i], GST_MAP_READ));
 
       input[i].data = in_info[i].data;
@@ -685,8 +718,13 @@ gst_tensordec_transform (GstBaseTransform * trans,
     res = self->decoder->decode (&self->plugin_data, &self->tensor_config,
         input, outbuf);
 
-    for (i = 0; i < num_tensors; i++)
+    for (i = 0; i < num_tensors; i++) {
       gst_memory_unmap (in_mem[i], &in_info[i]);
+      gst_memory_unref (in_mem[i]);
+    }
+
+    if (contiguous)
+      gst_buffer_unref (contiguous);
   } else {
     GST_ERROR_OBJECT (self, "Decoder plugin not yet configured.");
     goto unknown_type;
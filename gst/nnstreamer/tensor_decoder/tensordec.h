@@ -73,6 +73,8 @@ struct _GstTensorDec
 
   const GstTensorDecoderDef *decoder; /**< Plugin object */
   void *plugin_data;
+
+  GstBufferPool *contiguous_pool; /**< The pool to copy an input tensor with several memory blocks into a contiguous buffer */
 };
 
 /**
@@ -233,6 +233,7 @@ gst_tensor_filter_init (GstTensorFilter * self)
   priv = &self->priv;
 
   gst_tensor_filter_common_init_property (priv);
+  self->contiguous_pool = NULL;
 }
 
 /**
@@ -272,6 +273,65 @@ gst_tensor_filter_get_output_size (GstTensorFilter * self, guint index)
   return gst_tensor_info_get_size (&info->info[index]);
 }
 
+/**
+ * @brief The input tensors of an invoke.
+ * The sub-plugin may return a part of the input as its output (e.g., pass-through without copying) if it allocates the output in invoke, so the input memory blocks are kept mapped until all of the outputs are released.
+ */
+typedef struct
+{
+  gint refcount; /**< the invoke and the output memory blocks referring to this */
+  guint num_tensors; /**< the number of input tensors */
+  GstMemory *mem[NNS_TENSOR_SIZE_LIMIT]; /**< the input memory blocks */
+  GstMapInfo info[NNS_TENSOR_SIZE_LIMIT]; /**< the map info of the input memory blocks */
+  GstBuffer *contiguous; /**< the contiguous copy of the input tensor with several memory blocks, NULL if not copied */
+} GstTensorFilterInput;
+
+/**
+ * @brief An output tensor allocated by the sub-plugin in invoke.
+ */
+typedef struct
+{
+  gpointer data; /**< the output tensor allocated by the sub-plugin */
+  GDestroyNotify destroy; /**< the function to release the output tensor */
+  GstTensorFilterInput *input; /**< the input tensors of the invoke */
+} GstTensorFilterOutput;
+
+/**
+ * @brief Release the reference of the input tensors, unmap and unref the memory blocks with the last one.
+ */
+static void
+gst_tensor_filter_release_input (GstTensorFilterInput * input)
+{
+  guint i;
+
+  if (!g_atomic_int_dec_and_test (&input->refcount))
+    return;
+
+  for (i = 0; i < input->num_tensors; i++) {
+    gst_memory_unmap (input->mem[i], &input->info[i]);
+    gst_memory_unref (input->mem[i]);
+  }
+
+  /* return the contiguous buffer to the pool after its memory is released */
+  if (input->contiguous)
+    gst_buffer_unref (input->contiguous);
+
+  g_free (input);
+}
+
+/**
+ * @brief Release the output tensor allocated by the sub-plugin, and then its input tensors.
+ */
+static void
+gst_tensor_filter_release_output (gpointer data)
+{
+  GstTensorFilterOutput *output = (GstTensorFilterOutput *) data;
+
+  output->destroy (output->data);
+  gst_tensor_filter_release_input (output->input);
+  g_free (output);
+}
+
 /**
  * @brief Setter for tensor_filter properties.
  */
@@ -320,13 +380,13 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
   GstTensorFilter *self;
   GstTensorFilterPrivate *priv;
   GstTensorFilterProperties *prop;
-  GstMemory *in_mem[NNS_TENSOR_SIZE_LIMIT];
-  GstMapInfo in_info[NNS_TENSOR_SIZE_LIMIT];
+  GstTensorFilterInput *input;
+  GstTensorFilterOutput *output;
   GstMemory *out_mem[NNS_TENSOR_SIZE_LIMIT];
   GstMapInfo out_info[NNS_TENSOR_SIZE_LIMIT];
   GstTensorMemory in_tensors[NNS_TENSOR_SIZE_LIMIT];
   GstTensorMemory out_tensors[NNS_TENSOR_SIZE_LIMIT];
-  guint i;
+  guint i, n_mem;
   gint ret;
 
   self = GST_TENSOR_FILTER_CAST (trans);
@@ -348,14 +408,40 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
       GST_STR_NULL (prop->model_file));
 
   /* 1. Set input tensors from inbuf. */
-  g_assert (gst_buffer_n_memory (inbuf) == prop->input_meta.num_tensors);
+  n_mem = gst_buffer_n_memory (inbuf);
+  if (n_mem != prop->input_meta.num_tensors) {
+    /**
+     * A single tensor may consist of several memory blocks
+     * (e.g., tensor_merge with zero-copy), map it as one block.
+     */
+    if (prop->input_meta.num_tensors != 1 || n_mem == 0)
+      goto invalid_memory;
+  }
 
-  for (i = 0; i < prop->input_meta.num_tensors; i++) {
-    in_mem[i] = gst_buffer_peek_memory (inbuf, i);
-    g_assert (gst_memory_map (in_mem[i], &in_info[i], GST_MAP_READ));
+  input = g_new (GstTensorFilterInput, 1);
+  input->refcount = 1;
+  input->num_tensors = prop->input_meta.num_tensors;
+  input->contiguous = NULL;
+
+  if (n_mem != prop->input_meta.num_tensors) {
+    /* copy the memory blocks into a buffer from the pool, not to allocate a new block for each frame */
+    input->contiguous =
+        gst_tensor_buffer_get_contiguous (&self->contiguous_pool, inbuf);
+    if (input->contiguous == NULL) {
+      g_free (input);
+      goto no_contiguous_buffer;
+    }
+  }
 
-    in_tensors[i].data = in_info[i].data;
-    in_tensors[i].size = in_info[i].size;
+  for (i = 0; i < prop->input_meta.num_tensors; i++) {
+    if (input->contiguous)
+      input->mem[i] = gst_buffer_get_memory (input->contiguous, 0);
+    else
+      input->mem[i] = gst_buffer_get_memory (inbuf, i);
+    g_assert (gst_memory_map (input->mem[i], &input->info[i], GST_MAP_READ));
+
+    in_tensors[i].data = input->info[i].data;
+    in_tensors[i].size = input->info[i].size;
     in_tensors[i].type = prop->input_meta.info[i].type;
   }
 
@@ -369,7 +455,7 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
     out_tensors[i].type = prop->output_meta.info[i].type;
 
     /* allocate memory if allocate_in_invoke is FALSE */
-    if (priv->fw->allocate_in_invoke == FALSE) {
+    if (priv->allocate_in_invoke == FALSE) {
       out_mem[i] = gst_allocator_alloc (NULL, out_tensors[i].size, NULL);
       g_assert (gst_memory_map (out_mem[i], &out_info[i], GST_MAP_WRITE));
 
@@ -379,17 +465,36 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
 
   /* 3. Call the filter-subplugin callback, "invoke" */
   gst_tensor_filter_call (priv, ret, invoke_NN, in_tensors, out_tensors);
-  /** @todo define enum to indicate status code */
-  g_assert (ret >= 0);
 
   /* 4. Update result and free map info. */
+  /** @todo define enum to indicate status code */
+  if (ret < 0) {
+    if (priv->allocate_in_invoke == FALSE) {
+      for (i = 0; i < prop->output_meta.num_tensors; i++) {
+        gst_memory_unmap (out_mem[i], &out_info[i]);
+        gst_memory_unref (out_mem[i]);
+      }
+    }
+
+    gst_tensor_filter_release_input (input);
+    goto invoke_failed;
+  }
+
   for (i = 0; i < prop->output_meta.num_tensors; i++) {
-    if (priv->fw->allocate_in_invoke) {
-      /* filter-subplugin allocated new memory, update this */
+    if (priv->allocate_in_invoke) {
+      /**
+       * filter-subplugin allocated new memory, update this.
+       * The output may refer to the input, keep the input until it is released.
+       */
+      output = g_new (GstTensorFilterOutput, 1);
+      output->data = out_tensors[i].data;
+      output->destroy = priv->destroy_notify;
+      output->input = input;
+      g_atomic_int_inc (&input->refcount);
+
       out_mem[i] =
           gst_memory_new_wrapped (0, out_tensors[i].data, out_tensors[i].size,
-          0, out_tensors[i].size, out_tensors[i].data,
-          priv->fw->destroyNotify ? priv->fw->destroyNotify : g_free);
+          0, out_tensors[i].size, output, gst_tensor_filter_release_output);
     } else {
       gst_memory_unmap (out_mem[i], &out_info[i]);
     }
@@ -398,9 +503,7 @@ gst_tensor_filter_transform (GstBaseTransform * trans,
     gst_buffer_append_memory (outbuf, out_mem[i]);
   }
 
-  for (i = 0; i < prop->input_meta.num_tensors; i++) {
-    gst_memory_unmap (in_mem[i], &in_info[i]);
-  }
+  gst_tensor_filter_release_input (input);
 
   /* 5. Return result! */
   if (ret > 0) {
@@ -433,6 +536,19 @@ unknown_invoke:
   GST_ELEMENT_ERROR (self, CORE, NOT_IMPLEMENTED, (NULL),
       ("invoke function is not defined"));
   return GST_FLOW_ERROR;
+invoke_failed:
+  GST_ELEMENT_ERROR (self, STREAM, FAILED, (NULL),
+      ("failed to invoke %s (%d)", priv->fw->name, ret));
+  return GST_FLOW_ERROR;
+invalid_memory:
+  GST_ELEMENT_ERROR (self, STREAM, FORMAT, (NULL),
+      ("the number of memory blocks (%u) does not match the number of input tensors (%u)",
+          n_mem, prop->input_meta.num_tensors));
+  return GST_FLOW_ERROR;
+no_contiguous_buffer:
+  GST_ELEMENT_ERROR (self, RESOURCE, FAILED, (NULL),
+      ("failed to get a contiguous buffer for the input tensor"));
+  return GST_FLOW_ERROR;
 }
 
 /**
@@ -902,5 +1018,11 @@ gst_tensor_filter_stop (GstBaseTransform * trans)
   priv = &self->priv;
 
   gst_tensor_filter_common_close_fw (priv);
+
+  if (self->contiguous_pool) {
+    gst_buffer_pool_set_active (self->contiguous_pool, FALSE);
+    gst_object_unref (self->contiguous_pool);
+    self->contiguous_pool = NULL;
+  }
   return TRUE;
 }
@@ -63,6 +63,7 @@ struct _GstTensorFilter
   GstBaseTransform element;     /**< This is the parent object */
 
   GstTensorFilterPrivate priv; /**< Internal properties for tensor-filter */
+  GstBufferPool *contiguous_pool; /**< The pool to copy an input tensor with several memory blocks into a contiguous buffer */
 };
 
 /**
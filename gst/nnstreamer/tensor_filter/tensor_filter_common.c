@@ -332,6 +332,8 @@ gst_tensor_filter_common_init_property (GstTensorFilterPrivate * priv)
   priv->privateData = NULL;
   priv->silent = TRUE;
   priv->configured = FALSE;
+  priv->allocate_in_invoke = FALSE;
+  priv->destroy_notify = NULL;
   gst_tensors_config_init (&priv->in_config);
   gst_tensors_config_init (&priv->out_config);
 }
@@ -731,6 +733,23 @@ gst_tensor_filter_common_open_fw (GstTensorFilterPrivate * priv)
     } else {
       priv->prop.fw_opened = TRUE;
     }
+
+    if (priv->prop.fw_opened) {
+      /* the sub-plugin may decide the output allocation for each instance */
+      priv->destroy_notify = NULL;
+
+      if (priv->fw->allocateInInvoke) {
+        priv->allocate_in_invoke =
+            (priv->fw->allocateInInvoke (&priv->privateData,
+                &priv->destroy_notify) == 0);
+      } else {
+        priv->allocate_in_invoke = (priv->fw->allocate_in_invoke != 0);
+      }
+
+      if (priv->destroy_notify == NULL)
+        priv->destroy_notify =
+            priv->fw->destroyNotify ? priv->fw->destroyNotify : g_free;
+    }
   }
 }
 
@@ -749,5 +768,7 @@ gst_tensor_filter_common_close_fw (GstTensorFilterPrivate * priv)
     priv->prop.fwname = NULL;
     priv->fw = NULL;
     priv->privateData = NULL;
+    priv->allocate_in_invoke = FALSE;
+    priv->destroy_notify = NULL;
   }
 }
@@ -43,6 +43,8 @@ typedef struct _GstTensorFilterPrivate
   gboolean configured; /**< True if already successfully configured tensor metadata */
   GstTensorsConfig in_config; /**< input tensor info */
   GstTensorsConfig out_config; /**< output tensor info */
+  gboolean allocate_in_invoke; /**< True if invoke_NN of the opened instance allocates the output tensors */
+  GDestroyNotify destroy_notify; /**< The function to release the output tensors allocated by invoke_NN */
 } GstTensorFilterPrivate;
 
 /**
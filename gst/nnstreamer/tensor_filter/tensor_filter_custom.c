@@ -28,6 +28,7 @@
 
 #include <glib.h>
 #include <dlfcn.h>
+#include <errno.h>
 
 #include "tensor_filter_custom.h"
 #include "nnstreamer_plugin_api_filter.h"
@@ -38,6 +39,22 @@ void fini_filter_custom (void) __attribute__ ((destructor));
 
 static GstTensorFilterFramework NNS_support_custom;
 
+/**
+ * @brief The default extended class for the custom filter without NNStreamer_custom_ext.
+ */
+static NNStreamer_custom_class_ext custom_ext_default = {
+  .serialize = FALSE,
+  .invoke_batch = NULL,
+  .get_output_pool = NULL,
+};
+
+/**
+ * @brief The locks to serialize the calls to the custom filters which request serialization. (handle of .so : GMutex)
+ * @note The instances with the same .so share the lock, because the .so may have global data.
+ */
+static GHashTable *custom_locks = NULL;
+G_LOCK_DEFINE_STATIC (custom_locks);
+
 /**
  * @brief internal_data
  */
@@ -45,11 +62,64 @@ struct _internal_data
 {
   void *handle;
   NNStreamer_custom_class *methods;
+  NNStreamer_custom_class_ext *methods_ext;
+  GMutex *lock; /**< NULL if the calls to the custom filter are not serialized */
 
   void *customFW_private_data;
 };
 typedef struct _internal_data internal_data;
 
+/**
+ * @brief Lock the custom filter if it is not thread-safe.
+ */
+#define custom_lock(ptr) do { \
+      if ((ptr)->lock) g_mutex_lock ((ptr)->lock); \
+    } while (0)
+
+/**
+ * @brief Unlock the custom filter if it is not thread-safe.
+ */
+#define custom_unlock(ptr) do { \
+      if ((ptr)->lock) g_mutex_unlock ((ptr)->lock); \
+    } while (0)
+
+/**
+ * @brief Free the lock of the custom library.
+ */
+static void
+custom_free_lock (gpointer data)
+{
+  GMutex *lock = (GMutex *) data;
+
+  g_mutex_clear (lock);
+  g_free (lock);
+}
+
+/**
+ * @brief Get the lock of the custom library.
+ * @note The lock is kept until the subplugin is unloaded.
+ */
+static GMutex *
+custom_get_lock (void *handle)
+{
+  GMutex *lock;
+
+  G_LOCK (custom_locks);
+  if (custom_locks == NULL)
+    custom_locks = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+        NULL, custom_free_lock);
+
+  lock = g_hash_table_lookup (custom_locks, handle);
+  if (lock == NULL) {
+    lock = g_new0 (GMutex, 1);
+    g_mutex_init (lock);
+    g_hash_table_insert (custom_locks, handle, lock);
+  }
+  G_UNLOCK (custom_locks);
+
+  return lock;
+}
+
 /**
  * @brief Load the custom library. Will skip loading if it's already loaded.
  * @return 0 if successfully loaded. 1 if skipped (already loaded). -1 if error
@@ -98,8 +168,21 @@ custom_loadlib (const GstTensorFilterProperties * prop, void **private_data)
     return -1;
   }
 
+  /* The extended class is optional. */
+  ptr->methods_ext = dlsym (ptr->handle, "NNStreamer_custom_ext");
+  if (ptr->methods_ext)
+    ptr->methods_ext = *((NNStreamer_custom_class_ext **) ptr->methods_ext);
+  if (ptr->methods_ext == NULL)
+    ptr->methods_ext = &custom_ext_default;
+  dlerror ();
+
+  ptr->lock = !ptr->methods_ext->serialize ? NULL :
+      custom_get_lock (ptr->handle);
+
   g_assert (ptr->methods->initfunc);
+  custom_lock (ptr);
   ptr->customFW_private_data = ptr->methods->initfunc (prop);
+  custom_unlock (ptr);
 
   /* After init func, (getInput XOR setInput) && (getOutput XOR setInput) must hold! */
   /** @todo Double check if this check is really required and safe */
@@ -125,13 +208,110 @@ custom_open (const GstTensorFilterProperties * prop, void **private_data)
   ptr = *private_data;
   g_assert (!ptr->methods->invoke != !ptr->methods->allocate_invoke);   /* XOR! */
 
-  if (ptr->methods->allocate_invoke) {
-    NNS_support_custom.allocate_in_invoke = TRUE;
-    NNS_support_custom.destroyNotify = ptr->methods->destroy_notify;
-  }
+  /* The output memory blocks of get_output_pool are returned with destroy_notify. */
+  if (ptr->methods->invoke && ptr->methods_ext->get_output_pool)
+    g_assert (ptr->methods->destroy_notify);
   return 0;
 }
 
+/**
+ * @brief The optional callback for GstTensorFilterFramework
+ * @note Each instance loads its own custom filter, so the output allocation is decided for each instance.
+ * @param[out] destroy The function to release the output tensors allocated by the custom filter.
+ * @return 0 if the custom filter allocates the output tensors. -EINVAL if tensor_filter allocates them.
+ */
+static int
+custom_allocateInInvoke (void **private_data, void (**destroy) (void *data))
+{
+  internal_data *ptr = *private_data;
+
+  g_assert (ptr);
+
+  if (ptr->methods->allocate_invoke || ptr->methods_ext->get_output_pool) {
+    *destroy = ptr->methods->destroy_notify;
+    return 0;
+  }
+
+  return -EINVAL;
+}
+
+/**
+ * @brief Get the number of frames to call invoke_batch.
+ * @note The outermost dimension of the tensors is the batch.
+ * @return the number of frames. 1 if the custom filter cannot process a batch.
+ */
+static guint
+custom_get_batch_size (const GstTensorFilterProperties * prop,
+    internal_data * ptr)
+{
+  guint i, batch;
+
+  if (!ptr->methods_ext->invoke_batch || !ptr->methods->invoke)
+    return 1;
+
+  if (prop->input_meta.num_tensors == 0 || prop->output_meta.num_tensors == 0)
+    return 1;
+
+  batch = prop->input_meta.info[0].dimension[NNS_TENSOR_RANK_LIMIT - 1];
+
+  for (i = 0; i < prop->input_meta.num_tensors; i++) {
+    if (prop->input_meta.info[i].dimension[NNS_TENSOR_RANK_LIMIT - 1] != batch)
+      return 1;
+  }
+
+  for (i = 0; i < prop->output_meta.num_tensors; i++) {
+    if (prop->output_meta.info[i].dimension[NNS_TENSOR_RANK_LIMIT - 1] != batch)
+      return 1;
+  }
+
+  return (batch > 1) ? batch : 1;
+}
+
+/**
+ * @brief Call invoke_batch of the custom filter with the frames in the tensors.
+ * @note Each frame refers the memory of the given tensors without copy.
+ */
+static int
+custom_invoke_batch (const GstTensorFilterProperties * prop,
+    internal_data * ptr, const GstTensorMemory * input,
+    GstTensorMemory * output, guint batch)
+{
+  GstTensorMemory *in_frames, *out_frames;
+  guint i, k, num_in, num_out;
+  int ret;
+
+  num_in = prop->input_meta.num_tensors;
+  num_out = prop->output_meta.num_tensors;
+
+  in_frames = g_new0 (GstTensorMemory, batch * num_in);
+  out_frames = g_new0 (GstTensorMemory, batch * num_out);
+
+  for (k = 0; k < batch; k++) {
+    for (i = 0; i < num_in; i++) {
+      GstTensorMemory *frame = &in_frames[k * num_in + i];
+
+      frame->size = input[i].size / batch;
+      frame->type = input[i].type;
+      frame->data = (guint8 *) input[i].data + frame->size * k;
+    }
+
+    for (i = 0; i < num_out; i++) {
+      GstTensorMemory *frame = &out_frames[k * num_out + i];
+
+      frame->size = output[i].size / batch;
+      frame->type = output[i].type;
+      frame->data = (guint8 *) output[i].data + frame->size * k;
+    }
+  }
+
+  ret = ptr->methods_ext->invoke_batch (ptr->customFW_private_data, prop,
+      in_frames, out_frames, batch);
+
+  g_free (in_frames);
+  g_free (out_frames);
+  return ret;
+}
+
 /**
  * @brief The mandatory callback for GstTensorFilterFramework
  * @param prop The properties of parent object
@@ -145,21 +325,38 @@ custom_invoke (const GstTensorFilterProperties * prop, void **private_data,
 {
   int retval = custom_loadlib (prop, private_data);
   internal_data *ptr;
+  guint batch;
 
   /* Actually, tensor_filter must have called getInput/OutputDim first. */
   g_assert (retval == 1);
   g_assert (*private_data);
   ptr = *private_data;
 
+  custom_lock (ptr);
   if (ptr->methods->invoke) {
-    return ptr->methods->invoke (ptr->customFW_private_data, prop,
-        input, output);
+    if (ptr->methods_ext->get_output_pool) {
+      retval = ptr->methods_ext->get_output_pool (ptr->customFW_private_data,
+          prop, output);
+      if (retval != 0)
+        goto done;
+    }
+
+    batch = custom_get_batch_size (prop, ptr);
+    if (batch > 1)
+      retval = custom_invoke_batch (prop, ptr, input, output, batch);
+    else
+      retval = ptr->methods->invoke (ptr->customFW_private_data, prop,
+          input, output);
   } else if (ptr->methods->allocate_invoke) {
-    return ptr->methods->allocate_invoke (ptr->customFW_private_data,
+    retval = ptr->methods->allocate_invoke (ptr->customFW_private_data,
         prop, input, output);
   } else {
-    return -1;
+    retval = -1;
   }
+
+done:
+  custom_unlock (ptr);
+  return retval;
 }
 
 /**
@@ -180,7 +377,11 @@ custom_getInputDim (const GstTensorFilterProperties * prop, void **private_data,
     return -1;
   }
 
-  return ptr->methods->getInputDim (ptr->customFW_private_data, prop, info);
+  custom_lock (ptr);
+  retval = ptr->methods->getInputDim (ptr->customFW_private_data, prop, info);
+  custom_unlock (ptr);
+
+  return retval;
 }
 
 /**
@@ -201,7 +402,11 @@ custom_getOutputDim (const GstTensorFilterProperties * prop,
     return -1;
   }
 
-  return ptr->methods->getOutputDim (ptr->customFW_private_data, prop, info);
+  custom_lock (ptr);
+  retval = ptr->methods->getOutputDim (ptr->customFW_private_data, prop, info);
+  custom_unlock (ptr);
+
+  return retval;
 }
 
 /**
@@ -221,8 +426,12 @@ custom_setInputDim (const GstTensorFilterProperties * prop, void **private_data,
   if (ptr->methods->setInputDim == NULL)
     return -1;
 
-  return ptr->methods->setInputDim (ptr->customFW_private_data,
+  custom_lock (ptr);
+  retval = ptr->methods->setInputDim (ptr->customFW_private_data,
       prop, in_info, out_info);
+  custom_unlock (ptr);
+
+  return retval;
 }
 
 /**
@@ -233,7 +442,9 @@ custom_close (const GstTensorFilterProperties * prop, void **private_data)
 {
   internal_data *ptr = *private_data;
 
+  custom_lock (ptr);
   ptr->methods->exitfunc (ptr->customFW_private_data, prop);
+  custom_unlock (ptr);
   g_free (ptr);
   *private_data = NULL;
 }
@@ -253,7 +464,8 @@ static GstTensorFilterFramework NNS_support_custom = {
   .setInputDimension = custom_setInputDim,
   .open = custom_open,
   .close = custom_close,
-  .destroyNotify = NULL,        /* default null. if allocate_in_invoke is true, this will be set from custom filter. */
+  .destroyNotify = NULL,        /* default null. destroy_notify of the custom filter is given with allocateInInvoke. */
+  .allocateInInvoke = custom_allocateInInvoke,
 };
 
 /** @brief Initialize this object for tensor_filter subplugin runtime register */
@@ -268,4 +480,11 @@ void
 fini_filter_custom (void)
 {
   nnstreamer_filter_exit (NNS_support_custom.name);
+
+  G_LOCK (custom_locks);
+  if (custom_locks) {
+    g_hash_table_destroy (custom_locks);
+    custom_locks = NULL;
+  }
+  G_UNLOCK (custom_locks);
 }
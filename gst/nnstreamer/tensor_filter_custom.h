@@ -117,6 +117,31 @@ typedef int (*NNS_custom_allocate_invoke) (void *private_data,
  */
 typedef void (*NNS_custom_destroy_notify) (void * data);
 
+/**
+ * @brief Invoke the "main function" with the frames in a batch at once. Without allocating output buffer. (fill in the given output buffer)
+ * @param[in] private_data The pointer returned by NNStreamer_custom_init.
+ * @param[in] prop GstTensorFilter's property values. Do not change its values.
+ * @param[in] input The array of input tensors of all frames (num_frames x num_tensors). The i-th tensor of the k-th frame is input[k * num_tensors + i].
+ * @param[out] output The array of output tensors of all frames (num_frames x num_tensors), allocated by caller. The i-th tensor of the k-th frame is output[k * num_tensors + i].
+ * @param[in] num_frames The number of frames.
+ * @note The frames are the outermost dimension (dim[NNS_TENSOR_RANK_LIMIT - 1]) of the tensors given to tensor_filter (e.g., the frames from tensor_aggregator). The tensor info given by getInputDim/setInputDim (and prop) includes this dimension, but each frame has only one of them: a frame is the tensor with the outermost dimension 1, and its size is the tensor size divided by num_frames. Do not stride the frames with the size of the whole tensor.
+ * @return 0 if success
+ */
+typedef int (*NNS_custom_invoke_batch) (void *private_data,
+    const GstTensorFilterProperties * prop, const GstTensorMemory * input, GstTensorMemory * output,
+    unsigned int num_frames);
+
+/**
+ * @brief Get the memory blocks for output tensors from the pool of custom filter. Then, "invoke" fills in the given memory blocks.
+ * @param[in] private_data The pointer returned by NNStreamer_custom_init.
+ * @param[in] prop GstTensorFilter's property values. Do not change its values.
+ * @param[in,out] output The array of output tensors. The size of each tensor is given, and the memory block for output tensor should be given. (data in GstTensorMemory)
+ * @note The memory block is released with destroy_notify when the pipeline does not use it anymore, so that the custom filter can reuse it.
+ * @return 0 if success
+ */
+typedef int (*NNS_custom_get_output_pool) (void *private_data,
+    const GstTensorFilterProperties * prop, GstTensorMemory * output);
+
 /**
  * @brief Custom Filter Class
  *
@@ -135,9 +160,29 @@ struct _NNStreamer_custom_class
 };
 typedef struct _NNStreamer_custom_class NNStreamer_custom_class;
 
+/**
+ * @brief Extended Custom Filter Class
+ *
+ * Every field is OPTIONAL. A custom filter may define NNStreamer_custom_ext with this
+ * in addition to NNStreamer_custom. The custom filter without NNStreamer_custom_ext works as before.
+ * It is a separated symbol to keep the layout of NNStreamer_custom_class for the existing custom filters.
+ */
+struct _NNStreamer_custom_class_ext
+{
+  int serialize; /**< TRUE(nonzero) if the callbacks must not be called concurrently by the tensor_filter instances with the same custom filter (e.g., the custom filter has global data). Then, tensor_filter_custom.c serializes the calls to the custom filter. If FALSE, the callbacks may be called concurrently, as the custom filter without NNStreamer_custom_ext. */
+  NNS_custom_invoke_batch invoke_batch; /**< called instead of invoke if the tensors given to tensor_filter have the frames in the outermost dimension. This is valid only with invoke. */
+  NNS_custom_get_output_pool get_output_pool; /**< called before invoke to get the output memory blocks from the custom filter. This is valid only with invoke, and destroy_notify is MANDATORY to release the memory blocks. */
+};
+typedef struct _NNStreamer_custom_class_ext NNStreamer_custom_class_ext;
+
 /**
  * @brief A custom filter MUST define NNStreamer_custom. This object represents the custom filter itself.
  */
 extern NNStreamer_custom_class *NNStreamer_custom;
 
+/**
+ * @brief A custom filter MAY define NNStreamer_custom_ext. This object represents the extended capabilities of the custom filter.
+ */
+extern NNStreamer_custom_class_ext *NNStreamer_custom_ext;
+
 #endif /*__NNS_TENSOR_FILTER_CUSTOM_H__*/
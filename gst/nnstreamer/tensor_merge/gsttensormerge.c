@@ -62,6 +62,10 @@
 
 #include "gsttensormerge.h"
 
+#ifdef HAVE_ORC
+#include "transform-orc.h"
+#endif
+
 GST_DEBUG_CATEGORY_STATIC (gst_tensor_merge_debug);
 #define GST_CAT_DEFAULT gst_tensor_merge_debug
 
@@ -89,8 +93,20 @@ enum
   PROP_SYNC_MODE,
   PROP_SYNC_OPTION,
   PROP_SILENT,
+  PROP_ZERO_COPY,
+  PROP_LATENCY,
 };
 
+/**
+ * @brief Default for the property zero-copy.
+ */
+#define DEFAULT_ZERO_COPY FALSE
+
+/**
+ * @brief Default latency (ns) to wait for the stalled pads.
+ */
+#define DEFAULT_LATENCY 0
+
 /**
  * @brief the capabilities of the inputs and outputs.
  * describe the real formats here.
@@ -109,12 +125,17 @@ static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink_%u",
 
 static gboolean gst_tensor_merge_src_event (GstPad * pad, GstObject * parent,
     GstEvent * event);
+static gboolean gst_tensor_merge_src_query (GstPad * pad, GstObject * parent,
+    GstQuery * query);
 static GstPad *gst_tensor_merge_request_new_pad (GstElement * element,
     GstPadTemplate * templ, const gchar * name, const GstCaps * caps);
 static GstStateChangeReturn gst_tensor_merge_change_state (GstElement * element,
     GstStateChange transition);
 static gboolean gst_tensor_merge_sink_event (GstCollectPads * pads,
     GstCollectData * data, GstEvent * event, GstTensorMerge * tensor_merge);
+static GstFlowReturn gst_tensor_merge_clip (GstCollectPads * pads,
+    GstCollectData * data, GstBuffer * inbuf, GstBuffer ** outbuf,
+    GstTensorMerge * tensor_merge);
 static GstFlowReturn gst_tensor_merge_collected (GstCollectPads * pads,
     GstTensorMerge * tensor_merge);
 
@@ -123,6 +144,7 @@ static void gst_tensor_merge_set_property (GObject * object, guint prop_id,
 static void gst_tensor_merge_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
 static void gst_tensor_merge_finalize (GObject * object);
+static void gst_tensor_merge_reset_rows (GstTensorMerge * tensor_merge);
 
 #define gst_tensor_merge_parent_class parent_class
 G_DEFINE_TYPE (GstTensorMerge, gst_tensor_merge, GST_TYPE_ELEMENT);
@@ -167,6 +189,34 @@ gst_tensor_merge_class_init (GstTensorMergeClass * klass)
       g_param_spec_string ("sync_option", "Sync_Option",
           "Option for the time synchronization mode ?", "", G_PARAM_READWRITE));
 
+  /**
+   * GstTensorMerge::zero-copy:
+   *
+   * If TRUE and the tensors are laid back to back (e.g., merging along the outermost dimension),
+   * the memories of incoming tensors are appended to the merged tensor without copying.
+   * The merged tensor has multiple memories, downstream should map the whole buffer.
+   * tensor_filter and tensor_decoder need a contiguous tensor, they copy it once into a buffer from a pool.
+   * It costs the same copy as merging without zero-copy, thus this is for the downstream which
+   * maps the whole buffer (e.g., filesink) or splits the tensor again.
+   */
+  g_object_class_install_property (gobject_class, PROP_ZERO_COPY,
+      g_param_spec_boolean ("zero-copy", "Zero copy",
+          "Append the memories of incoming tensors without copying "
+          "when merging along the outermost dimension",
+          DEFAULT_ZERO_COPY, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorMerge::latency:
+   *
+   * Additional latency (ns) to wait for the stalled pads in live pipeline.
+   * The latency is added to the result of latency query, and used as the timeout of refresh mode if sync_option has no timeout.
+   */
+  g_object_class_install_property (gobject_class, PROP_LATENCY,
+      g_param_spec_uint64 ("latency", "Latency",
+          "Additional latency (ns) to wait for the stalled pads in live pipeline",
+          0, G_MAXUINT64, DEFAULT_LATENCY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->request_new_pad =
       GST_DEBUG_FUNCPTR (gst_tensor_merge_request_new_pad);
   gstelement_class->change_state =
@@ -200,6 +250,7 @@ gst_tensor_merge_init (GstTensorMerge * tensor_merge)
       gst_pad_new_from_template (gst_element_class_get_pad_template (klass,
           "src"), "src");
   gst_pad_set_event_function (tensor_merge->srcpad, gst_tensor_merge_src_event);
+  gst_pad_set_query_function (tensor_merge->srcpad, gst_tensor_merge_src_query);
 
   gst_element_add_pad (GST_ELEMENT (tensor_merge), tensor_merge->srcpad);
 
@@ -207,19 +258,30 @@ gst_tensor_merge_init (GstTensorMerge * tensor_merge)
   gst_collect_pads_set_event_function (tensor_merge->collect,
       (GstCollectPadsEventFunction)
       GST_DEBUG_FUNCPTR (gst_tensor_merge_sink_event), tensor_merge);
+  gst_collect_pads_set_clip_function (tensor_merge->collect,
+      (GstCollectPadsClipFunction) GST_DEBUG_FUNCPTR (gst_tensor_merge_clip),
+      tensor_merge);
   gst_collect_pads_set_function (tensor_merge->collect,
       (GstCollectPadsFunction) GST_DEBUG_FUNCPTR (gst_tensor_merge_collected),
       tensor_merge);
 
   tensor_merge->silent = TRUE;
+  tensor_merge->zero_copy = DEFAULT_ZERO_COPY;
   tensor_merge->sync.mode = SYNC_NOSYNC;
   tensor_merge->sync.option = NULL;
+  tensor_merge->sync.latency = DEFAULT_LATENCY;
   gst_tensors_config_init (&tensor_merge->tensors_config);
   tensor_merge->mode = GTT_END;
   tensor_merge->loaded = FALSE;
   tensor_merge->need_buffer = FALSE;
   tensor_merge->current_time = 0;
   tensor_merge->need_set_time = TRUE;
+
+  memset (&tensor_merge->rows, 0, sizeof (tensor_merge_rows));
+  tensor_merge->rows.num_threads = 1;
+  g_mutex_init (&tensor_merge->rows.lock);
+  g_cond_init (&tensor_merge->rows.cond);
+  tensor_merge->pool = NULL;
 }
 
 static const gchar *gst_tensor_merge_mode_string[] = {
@@ -276,6 +338,10 @@ gst_tensor_merge_finalize (GObject * object)
     tensor_merge->sync.option = NULL;
   }
 
+  gst_tensor_merge_reset_rows (tensor_merge);
+  g_mutex_clear (&tensor_merge->rows.lock);
+  g_cond_clear (&tensor_merge->rows.cond);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -314,7 +380,9 @@ gst_tensor_merge_request_new_pad (GstElement * element, GstPadTemplate * templ,
 
     tensormergepad = (GstTensorCollectPadData *)
         gst_collect_pads_add_pad (tensor_merge->collect, newpad,
-        sizeof (GstTensorCollectPadData), NULL, TRUE);
+        sizeof (GstTensorCollectPadData), NULL, FALSE);
+    gst_tensor_time_sync_set_pad_waiting (tensor_merge->collect,
+        &tensor_merge->sync);
 
     tensormergepad->pad = newpad;
     gst_pad_set_element_private (newpad, tensormergepad);
@@ -345,6 +413,25 @@ gst_tensor_merge_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
   return gst_pad_event_default (pad, parent, event);
 }
 
+/**
+ * @brief src query vmethod
+ */
+static gboolean
+gst_tensor_merge_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  GstTensorMerge *tensor_merge = GST_TENSOR_MERGE (parent);
+
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_LATENCY:
+      return gst_tensor_time_sync_query_latency (pad, parent, query,
+          &tensor_merge->sync);
+    default:
+      break;
+  }
+
+  return gst_pad_query_default (pad, parent, query);
+}
+
 /**
  * @brief sink event vmethod
  */
@@ -357,6 +444,7 @@ gst_tensor_merge_sink_event (GstCollectPads * pads, GstCollectData * data,
   switch (GST_EVENT_TYPE (event)) {
     case GST_EVENT_FLUSH_STOP:
       tensor_merge->need_segment = TRUE;
+      gst_tensor_time_sync_reset (&tensor_merge->sync);
       break;
     default:
       break;
@@ -456,151 +544,426 @@ gst_tensor_merge_collect_buffer (GstTensorMerge * tensor_merge,
 }
 
 
+/**
+ * @brief The max number of threads to merge the tensors.
+ */
+#define MERGE_MAX_THREADS 4
+
+/**
+ * @brief The min bytes of merged tensor for a thread.
+ */
+#define MERGE_MIN_BYTES_PER_THREAD (512 * 1024)
+
+/**
+ * @brief Macro to copy the rows with fixed size (memcpy with constant size is inlined).
+ */
+#define merge_copy_rows(dest,dest_stride,src,size,n) do { \
+    gsize _r; \
+    for (_r = 0; _r < (n); _r++) { \
+      memcpy ((dest), (src), (size)); \
+      (dest) += (dest_stride); \
+      (src) += (size); \
+    } \
+  } while (0)
+
+/**
+ * @brief Copy the rows of incoming tensor into the rows of merged tensor.
+ * @param dest the first row of merged tensor (with the offset of incoming tensor)
+ * @param dest_stride the bytes of a row of merged tensor
+ * @param src the first row of incoming tensor
+ * @param size the bytes of a row of incoming tensor
+ * @param n the number of rows
+ */
+static void
+gst_tensor_merge_copy_rows (guint8 * dest, gsize dest_stride,
+    const guint8 * src, gsize size, gsize n)
+{
+  switch (size) {
+    case 1:
+      merge_copy_rows (dest, dest_stride, src, 1, n);
+      break;
+    case 2:
+      merge_copy_rows (dest, dest_stride, src, 2, n);
+      break;
+    case 3:
+      merge_copy_rows (dest, dest_stride, src, 3, n);
+      break;
+    case 4:
+      merge_copy_rows (dest, dest_stride, src, 4, n);
+      break;
+    case 6:
+      merge_copy_rows (dest, dest_stride, src, 6, n);
+      break;
+    case 8:
+      merge_copy_rows (dest, dest_stride, src, 8, n);
+      break;
+    case 12:
+      merge_copy_rows (dest, dest_stride, src, 12, n);
+      break;
+    case 16:
+      merge_copy_rows (dest, dest_stride, src, 16, n);
+      break;
+    default:
+      merge_copy_rows (dest, dest_stride, src, size, n);
+      break;
+  }
+}
+
+/**
+ * @brief Merge a part of the rows.
+ * @param rows the rows to merge the tensors
+ * @param start the first row
+ * @param end the last row (exclusive)
+ */
+static void
+gst_tensor_merge_rows_run_range (tensor_merge_rows * rows, gsize start,
+    gsize end)
+{
+  guint8 *dest;
+  gsize offset;
+  guint i;
+
+#ifdef HAVE_ORC
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  /* interleave the elements of two tensors */
+  if (rows->num_tensors == 2 && rows->in_row_size[0] == rows->element_size &&
+      rows->in_row_size[1] == rows->element_size) {
+    const guint8 *src0 = rows->src[0] + start * rows->element_size;
+    const guint8 *src1 = rows->src[1] + start * rows->element_size;
+
+    dest = rows->dest + start * rows->out_row_size;
+
+    switch (rows->element_size) {
+      case 1:
+        nns_orc_merge_u8 ((guint16 *) dest, src0, src1, end - start);
+        return;
+      case 2:
+        nns_orc_merge_u16 ((guint32 *) dest, (const guint16 *) src0,
+            (const guint16 *) src1, end - start);
+        return;
+      case 4:
+        nns_orc_merge_u32 ((guint64 *) dest, (const guint32 *) src0,
+            (const guint32 *) src1, end - start);
+        return;
+      default:
+        break;
+    }
+  }
+#endif
+#endif
+
+  /* copy the rows of each tensor, the incoming tensor is read sequentially */
+  offset = 0;
+  for (i = 0; i < rows->num_tensors; i++) {
+    const gsize size = rows->in_row_size[i];
+
+    dest = rows->dest + start * rows->out_row_size + offset;
+    gst_tensor_merge_copy_rows (dest, rows->out_row_size,
+        rows->src[i] + start * size, size, end - start);
+    offset += size;
+  }
+}
+
+/**
+ * @brief Merge the rows of a job.
+ */
+static void
+gst_tensor_merge_rows_run_job (tensor_merge_rows * rows, guint job)
+{
+  gsize chunk = (rows->num_rows + rows->num_threads - 1) / rows->num_threads;
+  gsize start = job * chunk;
+  gsize end = MIN (start + chunk, rows->num_rows);
+
+  if (start < end)
+    gst_tensor_merge_rows_run_range (rows, start, end);
+}
+
+/**
+ * @brief The function of thread pool.
+ */
+static void
+gst_tensor_merge_rows_thread_func (gpointer job, gpointer user_data)
+{
+  tensor_merge_rows *rows = user_data;
+
+  gst_tensor_merge_rows_run_job (rows, GPOINTER_TO_UINT (job));
+
+  g_mutex_lock (&rows->lock);
+  rows->pending--;
+  g_cond_signal (&rows->cond);
+  g_mutex_unlock (&rows->lock);
+}
+
+/**
+ * @brief Merge the rows of current frame with the threads.
+ */
+static void
+gst_tensor_merge_rows_run (tensor_merge_rows * rows)
+{
+  guint job;
+
+  if (rows->pool == NULL) {
+    gst_tensor_merge_rows_run_job (rows, 0);
+    return;
+  }
+
+  g_mutex_lock (&rows->lock);
+  rows->pending = rows->num_threads - 1;
+  g_mutex_unlock (&rows->lock);
+
+  /* job index starts from 1, the caller merges the first part */
+  for (job = 1; job < rows->num_threads; job++)
+    g_thread_pool_push (rows->pool, GUINT_TO_POINTER (job), NULL);
+
+  gst_tensor_merge_rows_run_job (rows, 0);
+
+  g_mutex_lock (&rows->lock);
+  while (rows->pending > 0)
+    g_cond_wait (&rows->cond, &rows->lock);
+  g_mutex_unlock (&rows->lock);
+}
+
+/**
+ * @brief Release the threads and buffer pool to merge the tensors.
+ * @param tensor_merge tensor merger
+ */
+static void
+gst_tensor_merge_reset_rows (GstTensorMerge * tensor_merge)
+{
+  tensor_merge_rows *rows = &tensor_merge->rows;
+
+  if (rows->pool) {
+    g_thread_pool_free (rows->pool, FALSE, TRUE);
+    rows->pool = NULL;
+  }
+
+  rows->num_tensors = 0;
+  rows->num_threads = 1;
+  rows->zero_copy = FALSE;
+
+  if (tensor_merge->pool) {
+    gst_buffer_pool_set_active (tensor_merge->pool, FALSE);
+    gst_object_unref (tensor_merge->pool);
+    tensor_merge->pool = NULL;
+  }
+}
+
+/**
+ * @brief Check the memories of incoming tensors can be appended to the merged tensor.
+ * @param tensor_merge tensor merger (the rows are configured)
+ * @return TRUE if zero-copy is enabled and the tensors are laid back to back
+ */
+static gboolean
+gst_tensor_merge_is_zero_copy (GstTensorMerge * tensor_merge)
+{
+  return (tensor_merge->zero_copy && tensor_merge->rows.num_tensors > 0 &&
+      tensor_merge->rows.num_rows == 1);
+}
+
+/**
+ * @brief Configure the rows and buffer pool to merge the tensors.
+ * @param tensor_merge tensor merger
+ * @param caps the caps of merged tensor
+ * @param config the config of merged tensor
+ * @return TRUE if successfully configured
+ */
+static gboolean
+gst_tensor_merge_configure_rows (GstTensorMerge * tensor_merge,
+    GstCaps * caps, GstTensorConfig * config)
+{
+  tensor_merge_rows *rows = &tensor_merge->rows;
+  GstTensorsInfo *info = &tensor_merge->tensors_config.info;
+  GstStructure *pool_config;
+  gsize out_size;
+  guint i, j, direction;
+
+  gst_tensor_merge_reset_rows (tensor_merge);
+
+  if (tensor_merge->mode != GTT_LINEAR)
+    return FALSE;
+
+  direction = tensor_merge->data_linear.direction;
+
+  rows->num_tensors = info->num_tensors;
+  rows->element_size = gst_tensor_get_element_size (config->info.type);
+  rows->out_row_size = 0;
+  rows->num_rows = 1;
+
+  for (i = 0; i < info->num_tensors; i++) {
+    rows->in_row_size[i] = rows->element_size;
+    for (j = 0; j <= direction; j++)
+      rows->in_row_size[i] *= info->info[i].dimension[j];
+
+    rows->out_row_size += rows->in_row_size[i];
+  }
+
+  for (j = direction + 1; j < NNS_TENSOR_RANK_LIMIT; j++)
+    rows->num_rows *= config->info.dimension[j];
+
+  /* keep the mode, the property may be changed while the pipeline is running */
+  rows->zero_copy = gst_tensor_merge_is_zero_copy (tensor_merge);
+  if (rows->zero_copy) {
+    GST_DEBUG_OBJECT (tensor_merge, "Append the memories without copying");
+    return TRUE;
+  }
+
+  out_size = rows->out_row_size * rows->num_rows;
+
+  /* split the rows of large tensor */
+  rows->num_threads = MIN (g_get_num_processors (), MERGE_MAX_THREADS);
+  rows->num_threads = MIN (rows->num_threads,
+      out_size / MERGE_MIN_BYTES_PER_THREAD);
+  rows->num_threads = MIN (rows->num_threads, rows->num_rows);
+  if (rows->num_threads == 0)
+    rows->num_threads = 1;
+
+  if (rows->num_threads > 1) {
+    rows->pool = g_thread_pool_new (gst_tensor_merge_rows_thread_func, rows,
+        rows->num_threads - 1, TRUE, NULL);
+    if (rows->pool == NULL)
+      rows->num_threads = 1;
+  }
+
+  GST_DEBUG_OBJECT (tensor_merge, "Merge %zd rows (%zd bytes) with %u threads",
+      rows->num_rows, rows->out_row_size, rows->num_threads);
+
+  tensor_merge->pool = gst_buffer_pool_new ();
+  pool_config = gst_buffer_pool_get_config (tensor_merge->pool);
+  gst_buffer_pool_config_set_params (pool_config, caps, out_size, 0, 0);
+
+  if (!gst_buffer_pool_set_config (tensor_merge->pool, pool_config) ||
+      !gst_buffer_pool_set_active (tensor_merge->pool, TRUE)) {
+    GST_ERROR_OBJECT (tensor_merge, "Failed to activate buffer pool.");
+    gst_object_unref (tensor_merge->pool);
+    tensor_merge->pool = NULL;
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief Generate Output GstMemory
  * @param tensor_merge tensor merger
  * @param tensors_buf collected tensors buffer
- * @param tensor_buf output tensor buffer
- * @return boolean
+ * @param tensor_buf output tensor buffer (from the buffer pool)
+ * @return GST_FLOW_OK if the tensors are merged
  */
 static GstFlowReturn
 gst_tensor_merge_generate_mem (GstTensorMerge * tensor_merge,
     GstBuffer * tensors_buf, GstBuffer * tensor_buf)
 {
   GstFlowReturn ret = GST_FLOW_OK;
+  tensor_merge_rows *rows = &tensor_merge->rows;
   GstMapInfo mInfo[NNS_TENSOR_SIZE_LIMIT];
   GstMemory *mem[NNS_TENSOR_SIZE_LIMIT];
   GstMapInfo outInfo;
-  GstMemory *outMem;
-  uint8_t *inptr, *outptr;
-  int num_mem = tensor_merge->tensors_config.info.num_tensors;
-  int i, j, k, l;
-  size_t outSize = 0;
-  guint element_size;
-  tensor_dim dim;
-  tensor_type type;
-
-  memcpy (&dim, &tensor_merge->tensors_config.info.info[0].dimension,
-      sizeof (tensor_dim));
-  type = tensor_merge->tensors_config.info.info[0].type;
-  element_size = gst_tensor_get_element_size (type);
+  guint i, num_mapped;
 
-  for (i = 0; i < num_mem; i++) {
-    mem[i] = gst_buffer_peek_memory (tensors_buf, i);
-    g_assert (gst_memory_map (mem[i], &mInfo[i], GST_MAP_READ));
-    outSize += mInfo[i].size;
+  if (gst_buffer_n_memory (tensors_buf) != rows->num_tensors) {
+    GST_ERROR_OBJECT (tensor_merge, "Invalid number of tensors (%u/%u).",
+        gst_buffer_n_memory (tensors_buf), rows->num_tensors);
+    return GST_FLOW_ERROR;
   }
 
-  outMem = gst_allocator_alloc (NULL, outSize, NULL);
-  g_assert (gst_memory_map (outMem, &outInfo, GST_MAP_WRITE));
-  outptr = outInfo.data;
+  for (num_mapped = 0; num_mapped < rows->num_tensors; num_mapped++) {
+    mem[num_mapped] = gst_buffer_peek_memory (tensors_buf, num_mapped);
+    if (!gst_memory_map (mem[num_mapped], &mInfo[num_mapped], GST_MAP_READ)) {
+      GST_ERROR_OBJECT (tensor_merge, "Failed to map the %u-th tensor.",
+          num_mapped);
+      ret = GST_FLOW_ERROR;
+      goto done;
+    }
 
-  switch (tensor_merge->mode) {
-    case GTT_LINEAR:
-    {
-      switch (tensor_merge->data_linear.direction) {
-        case LINEAR_FIRST:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (i = 0; i < dim[2]; i++) {
-              for (j = 0; j < dim[1]; j++) {
-                for (k = 0; k < num_mem; k++) {
-                  size_t c =
-                      tensor_merge->tensors_config.info.info[k].dimension[0];
-                  size_t s = element_size * c;
-                  inptr =
-                      mInfo[k].data + (l * dim[2] * dim[1] + i * dim[1] +
-                      j) * s;
-                  memcpy (outptr, inptr, s);
-                  outptr += s;
-                }
-              }
-            }
+    if (mInfo[num_mapped].size !=
+        rows->in_row_size[num_mapped] * rows->num_rows) {
+      GST_ERROR_OBJECT (tensor_merge, "Invalid size of the %u-th tensor.",
+          num_mapped);
+      gst_memory_unmap (mem[num_mapped], &mInfo[num_mapped]);
+      ret = GST_FLOW_ERROR;
+      goto done;
+    }
 
-          }
-          ret = TRUE;
-        }
-          break;
-        case LINEAR_SECOND:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (i = 0; i < dim[2]; i++) {
-              for (k = 0; k < num_mem; k++) {
-                size_t c, s;
-
-                c = 1;
-                for (j = 0; j < LINEAR_SECOND + 1; j++)
-                  c *= tensor_merge->tensors_config.info.info[k].dimension[j];
-
-                s = element_size * c;
-
-                inptr = mInfo[k].data + (l * dim[2] + i) * s;
-
-                memcpy (outptr, inptr, s);
-                outptr += s;
-              }
-            }
-          }
-          ret = TRUE;
-        }
-          break;
-        case LINEAR_THIRD:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (k = 0; k < num_mem; k++) {
-              size_t c, s;
+    rows->src[num_mapped] = mInfo[num_mapped].data;
+  }
+
+  if (!gst_buffer_map (tensor_buf, &outInfo, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (tensor_merge, "Failed to map the output buffer.");
+    ret = GST_FLOW_ERROR;
+    goto done;
+  }
 
-              c = 1;
-              for (j = 0; j < LINEAR_THIRD + 1; j++)
-                c *= tensor_merge->tensors_config.info.info[k].dimension[j];
+  rows->dest = outInfo.data;
+  gst_tensor_merge_rows_run (rows);
+  gst_buffer_unmap (tensor_buf, &outInfo);
 
-              s = element_size * c;
+  gst_buffer_copy_into (tensor_buf, tensors_buf, GST_BUFFER_COPY_TIMESTAMPS, 0,
+      -1);
 
-              inptr = mInfo[k].data + l * s;
+done:
+  for (i = 0; i < num_mapped; i++)
+    gst_memory_unmap (mem[i], &mInfo[i]);
 
-              memcpy (outptr, inptr, s);
-              outptr += s;
-            }
-          }
-          ret = TRUE;
-        }
-          break;
-        case LINEAR_FOURTH:
-        {
-          for (k = 0; k < num_mem; k++) {
-            size_t c, s;
+  rows->dest = NULL;
+  return ret;
+}
 
-            c = 1;
-            for (j = 0; j < LINEAR_FOURTH + 1; j++)
-              c *= tensor_merge->tensors_config.info.info[k].dimension[j];
+/**
+ * @brief Append the memories of incoming tensors to the merged tensor without copying.
+ * @param tensor_merge tensor merger
+ * @param tensors_buf collected tensors buffer
+ * @param[out] tensor_buf merged tensor buffer
+ * @return GST_FLOW_OK if the memories are appended
+ */
+static GstFlowReturn
+gst_tensor_merge_append_mem (GstTensorMerge * tensor_merge,
+    GstBuffer * tensors_buf, GstBuffer ** tensor_buf)
+{
+  tensor_merge_rows *rows = &tensor_merge->rows;
+  GstMemory *mem;
+  GstBuffer *outbuf;
+  guint i;
+
+  if (gst_buffer_n_memory (tensors_buf) != rows->num_tensors) {
+    GST_ERROR_OBJECT (tensor_merge, "Invalid number of tensors (%u/%u).",
+        gst_buffer_n_memory (tensors_buf), rows->num_tensors);
+    return GST_FLOW_ERROR;
+  }
 
-            s = element_size * c;
+  outbuf = gst_buffer_new ();
 
-            inptr = mInfo[k].data;
-            memcpy (outptr, inptr, s);
-            outptr += s;
-          }
+  for (i = 0; i < rows->num_tensors; i++) {
+    mem = gst_buffer_peek_memory (tensors_buf, i);
 
-          ret = TRUE;
-        }
-          break;
-        default:
-          ret = FALSE;
-      }
+    if (gst_memory_get_sizes (mem, NULL, NULL) != rows->in_row_size[i]) {
+      GST_ERROR_OBJECT (tensor_merge, "Invalid size of the %u-th tensor.", i);
+      gst_buffer_unref (outbuf);
+      return GST_FLOW_ERROR;
     }
-      break;
-    default:
-      ret = FALSE;
+
+    gst_buffer_append_memory (outbuf, gst_memory_ref (mem));
   }
 
-  gst_buffer_append_memory (tensor_buf, outMem);
-  gst_buffer_copy_into (tensor_buf, tensors_buf, GST_BUFFER_COPY_TIMESTAMPS, 0,
+  gst_buffer_copy_into (outbuf, tensors_buf, GST_BUFFER_COPY_TIMESTAMPS, 0,
       -1);
-  for (i = 0; i < num_mem; i++)
-    gst_memory_unmap (mem[i], &mInfo[i]);
-  gst_memory_unmap (outMem, &outInfo);
 
-  return ret;
+  *tensor_buf = outbuf;
+  return GST_FLOW_OK;
+}
+
+/**
+ * @brief Clip function of collect pads, called with the incoming buffer of each pad.
+ * In refresh mode, it keeps the buffers of the pads except the base pad, and makes the tensors if the base pad is stalled.
+ */
+static GstFlowReturn
+gst_tensor_merge_clip (GstCollectPads * pads, GstCollectData * data,
+    GstBuffer * inbuf, GstBuffer ** outbuf, GstTensorMerge * tensor_merge)
+{
+  if (gst_tensor_time_sync_clip (pads, &tensor_merge->sync, data, inbuf,
+          outbuf))
+    return gst_tensor_merge_collected (pads, tensor_merge);
+
+  return GST_FLOW_OK;
 }
 
 /**
@@ -659,7 +1022,8 @@ gst_tensor_merge_collected (GstCollectPads * pads,
       goto nego_error;
     }
 
-    if (!gst_pad_set_caps (tensor_merge->srcpad, newcaps)) {
+    if (!gst_pad_set_caps (tensor_merge->srcpad, newcaps) ||
+        !gst_tensor_merge_configure_rows (tensor_merge, newcaps, &config)) {
       gst_caps_unref (newcaps);
       goto nego_error;
     }
@@ -685,10 +1049,28 @@ gst_tensor_merge_collected (GstCollectPads * pads,
     tensor_merge->need_segment = FALSE;
   }
 
-  tensor_buf = gst_buffer_new ();
-  g_assert (tensor_buf != NULL);
+  if (tensor_merge->rows.zero_copy) {
+    ret = gst_tensor_merge_append_mem (tensor_merge, tensors_buf, &tensor_buf);
+  } else {
+    ret = gst_buffer_pool_acquire_buffer (tensor_merge->pool, &tensor_buf,
+        NULL);
+    if (ret != GST_FLOW_OK) {
+      GST_WARNING_OBJECT (tensor_merge, "failed to get outbuf, result = %s",
+          gst_flow_get_name (ret));
+      goto beach;
+    }
+
+    ret = gst_tensor_merge_generate_mem (tensor_merge, tensors_buf,
+        tensor_buf);
+    if (ret != GST_FLOW_OK)
+      gst_buffer_unref (tensor_buf);
+  }
 
-  gst_tensor_merge_generate_mem (tensor_merge, tensors_buf, tensor_buf);
+  if (ret != GST_FLOW_OK) {
+    GST_ELEMENT_ERROR (tensor_merge, STREAM, FAILED, (NULL),
+        ("Failed to merge the tensors."));
+    goto beach;
+  }
 
   ret = gst_pad_push (tensor_merge->srcpad, tensor_buf);
   tensor_merge->need_set_time = TRUE;
@@ -718,6 +1100,9 @@ gst_tensor_merge_ready_to_paused (GstTensorMerge * tensor_merge)
   tensor_merge->need_stream_start = TRUE;
   tensor_merge->need_segment = TRUE;
   tensor_merge->negotiated = FALSE;
+  gst_tensor_time_sync_reset (&tensor_merge->sync);
+  gst_tensor_time_sync_set_pad_waiting (tensor_merge->collect,
+      &tensor_merge->sync);
   gst_collect_pads_start (tensor_merge->collect);
 }
 
@@ -736,6 +1121,7 @@ gst_tensor_merge_change_state (GstElement * element, GstStateChange transition)
       break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       gst_collect_pads_stop (tensor_merge->collect);
+      gst_tensor_merge_reset_rows (tensor_merge);
       break;
     default:
       break;
@@ -791,6 +1177,9 @@ gst_tensor_merge_set_property (GObject * object, guint prop_id,
     case PROP_SILENT:
       filter->silent = g_value_get_boolean (value);
       break;
+    case PROP_ZERO_COPY:
+      filter->zero_copy = g_value_get_boolean (value);
+      break;
     case PROP_MODE:
       filter->mode = gst_tensor_merge_get_mode (g_value_get_string (value));
       g_assert (filter->mode != GTT_END);
@@ -809,11 +1198,20 @@ gst_tensor_merge_set_property (GObject * object, guint prop_id,
       silent_debug ("Mode = %d(%s)\n", filter->sync.mode,
           gst_tensor_time_sync_get_mode_string (filter->sync.mode));
       gst_tensor_time_sync_set_option_data (&filter->sync);
+      gst_tensor_time_sync_set_pad_waiting (filter->collect, &filter->sync);
       break;
     case PROP_SYNC_OPTION:
       filter->sync.option = g_value_dup_string (value);
       silent_debug ("Option = %s\n", filter->sync.option);
       gst_tensor_time_sync_set_option_data (&filter->sync);
+      gst_tensor_time_sync_set_pad_waiting (filter->collect, &filter->sync);
+      break;
+    case PROP_LATENCY:
+      filter->sync.latency = g_value_get_uint64 (value);
+      silent_debug ("Latency = %" GST_TIME_FORMAT "\n",
+          GST_TIME_ARGS (filter->sync.latency));
+      gst_element_post_message (GST_ELEMENT (filter),
+          gst_message_new_latency (GST_OBJECT (filter)));
       break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -833,6 +1231,9 @@ gst_tensor_merge_get_property (GObject * object, guint prop_id,
     case PROP_SILENT:
       g_value_set_boolean (value, filter->silent);
       break;
+    case PROP_ZERO_COPY:
+      g_value_set_boolean (value, filter->zero_copy);
+      break;
     case PROP_MODE:
       g_value_set_string (value, gst_tensor_merge_mode_string[filter->mode]);
       break;
@@ -846,6 +1247,9 @@ gst_tensor_merge_get_property (GObject * object, guint prop_id,
     case PROP_SYNC_OPTION:
       g_value_set_string (value, filter->sync.option);
       break;
+    case PROP_LATENCY:
+      g_value_set_uint64 (value, filter->sync.latency);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -65,6 +65,28 @@ typedef struct _tensor_merge_linear {
   tensor_merge_linear_mode direction;
 } tensor_merge_linear;
 
+/**
+ * @brief Internal data to merge the tensors.
+ * The tensors are merged row by row, a row of each tensor includes the dimensions up to the merge direction.
+ */
+typedef struct _tensor_merge_rows {
+  guint num_tensors; /**< the number of incoming tensors */
+  gsize in_row_size[NNS_TENSOR_SIZE_LIMIT]; /**< the bytes of a row of each incoming tensor */
+  gsize out_row_size; /**< the bytes of a row of merged tensor */
+  gsize num_rows; /**< the number of rows */
+  guint element_size; /**< the bytes of an element */
+  gboolean zero_copy; /**< the memories are appended without copying (decided when the rows are configured) */
+
+  const guint8 *src[NNS_TENSOR_SIZE_LIMIT]; /**< the incoming tensors of current frame */
+  guint8 *dest; /**< the merged tensor of current frame */
+
+  guint num_threads; /**< the number of threads to merge the rows */
+  GThreadPool *pool; /**< the thread pool to merge the rows */
+  GMutex lock; /**< the lock for the jobs */
+  GCond cond; /**< the condition to wait for the jobs */
+  guint pending; /**< the number of pending jobs */
+} tensor_merge_rows;
+
 /**
  * @brief Tensor Merge data structure
  */
@@ -73,6 +95,7 @@ struct _GstTensorMerge
   GstElement element;
 
   gboolean silent;
+  gboolean zero_copy; /**< append the memories without copying if the tensors are laid back to back */
   tensor_time_sync_data sync;
   GstPad *srcpad;
   gchar *option;
@@ -92,6 +115,8 @@ struct _GstTensorMerge
   GstClockTime current_time;
   gboolean need_set_time;
   GstTensorsConfig tensors_config; /**< output tensors info */
+  tensor_merge_rows rows; /**< the rows to merge the tensors */
+  GstBufferPool *pool; /**< buffer pool for merged tensor */
 };
 
 /**
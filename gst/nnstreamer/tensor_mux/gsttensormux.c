@@ -87,8 +87,14 @@ enum
   PROP_SILENT,
   PROP_SYNC_MODE,
   PROP_SYNC_OPTION,
+  PROP_LATENCY,
 };
 
+/**
+ * @brief Default latency (ns) to wait for the stalled pads.
+ */
+#define DEFAULT_LATENCY 0
+
 /**
  * @brief Default caps string for sink pad.
  */
@@ -112,12 +118,17 @@ static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink_%u",
 
 static gboolean gst_tensor_mux_src_event (GstPad * pad, GstObject * parent,
     GstEvent * event);
+static gboolean gst_tensor_mux_src_query (GstPad * pad, GstObject * parent,
+    GstQuery * query);
 static GstPad *gst_tensor_mux_request_new_pad (GstElement * element,
     GstPadTemplate * templ, const gchar * name, const GstCaps * caps);
 static GstStateChangeReturn gst_tensor_mux_change_state (GstElement * element,
     GstStateChange transition);
 static gboolean gst_tensor_mux_sink_event (GstCollectPads * pads,
     GstCollectData * data, GstEvent * event, GstTensorMux * tensor_mux);
+static GstFlowReturn gst_tensor_mux_clip (GstCollectPads * pads,
+    GstCollectData * data, GstBuffer * inbuf, GstBuffer ** outbuf,
+    GstTensorMux * tensor_mux);
 static GstFlowReturn gst_tensor_mux_collected (GstCollectPads * pads,
     GstTensorMux * tesnor_mux);
 
@@ -163,6 +174,18 @@ gst_tensor_mux_class_init (GstTensorMuxClass * klass)
       g_param_spec_string ("sync_option", "Sync_Option",
           "Option for the time synchronization mode ?", "", G_PARAM_READWRITE));
 
+  /**
+   * GstTensorMux::latency:
+   *
+   * Additional latency (ns) to wait for the stalled pads in live pipeline.
+   * The latency is added to the result of latency query, and used as the timeout of refresh mode if sync_option has no timeout.
+   */
+  g_object_class_install_property (gobject_class, PROP_LATENCY,
+      g_param_spec_uint64 ("latency", "Latency",
+          "Additional latency (ns) to wait for the stalled pads in live pipeline",
+          0, G_MAXUINT64, DEFAULT_LATENCY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->request_new_pad =
       GST_DEBUG_FUNCPTR (gst_tensor_mux_request_new_pad);
   gstelement_class->change_state =
@@ -196,6 +219,7 @@ gst_tensor_mux_init (GstTensorMux * tensor_mux)
       gst_pad_new_from_template (gst_element_class_get_pad_template (klass,
           "src"), "src");
   gst_pad_set_event_function (tensor_mux->srcpad, gst_tensor_mux_src_event);
+  gst_pad_set_query_function (tensor_mux->srcpad, gst_tensor_mux_src_query);
 
   gst_element_add_pad (GST_ELEMENT (tensor_mux), tensor_mux->srcpad);
 
@@ -203,6 +227,9 @@ gst_tensor_mux_init (GstTensorMux * tensor_mux)
   gst_collect_pads_set_event_function (tensor_mux->collect,
       (GstCollectPadsEventFunction)
       GST_DEBUG_FUNCPTR (gst_tensor_mux_sink_event), tensor_mux);
+  gst_collect_pads_set_clip_function (tensor_mux->collect,
+      (GstCollectPadsClipFunction) GST_DEBUG_FUNCPTR (gst_tensor_mux_clip),
+      tensor_mux);
   gst_collect_pads_set_function (tensor_mux->collect,
       (GstCollectPadsFunction) GST_DEBUG_FUNCPTR (gst_tensor_mux_collected),
       tensor_mux);
@@ -210,6 +237,7 @@ gst_tensor_mux_init (GstTensorMux * tensor_mux)
   tensor_mux->silent = TRUE;
   tensor_mux->sync.mode = SYNC_NOSYNC;
   tensor_mux->sync.option = NULL;
+  tensor_mux->sync.latency = DEFAULT_LATENCY;
   tensor_mux->need_buffer = FALSE;
   tensor_mux->current_time = 0;
   tensor_mux->need_set_time = TRUE;
@@ -265,7 +293,9 @@ gst_tensor_mux_request_new_pad (GstElement * element, GstPadTemplate * templ,
     GstTensorCollectPadData *tensormuxpad;
     tensormuxpad = (GstTensorCollectPadData *)
         gst_collect_pads_add_pad (tensor_mux->collect, newpad,
-        sizeof (GstTensorCollectPadData), NULL, TRUE);
+        sizeof (GstTensorCollectPadData), NULL, FALSE);
+    gst_tensor_time_sync_set_pad_waiting (tensor_mux->collect,
+        &tensor_mux->sync);
     tensormuxpad->pad = newpad;
     gst_pad_set_element_private (newpad, tensormuxpad);
     gst_element_add_pad (element, newpad);
@@ -294,6 +324,25 @@ gst_tensor_mux_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
   return gst_pad_event_default (pad, parent, event);
 }
 
+/**
+ * @brief src query vmethod
+ */
+static gboolean
+gst_tensor_mux_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  GstTensorMux *tensor_mux = GST_TENSOR_MUX (parent);
+
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_LATENCY:
+      return gst_tensor_time_sync_query_latency (pad, parent, query,
+          &tensor_mux->sync);
+    default:
+      break;
+  }
+
+  return gst_pad_query_default (pad, parent, query);
+}
+
 /**
  * @brief sink event vmethod
  */
@@ -306,6 +355,7 @@ gst_tensor_mux_sink_event (GstCollectPads * pads, GstCollectData * data,
   switch (GST_EVENT_TYPE (event)) {
     case GST_EVENT_FLUSH_STOP:
       tensor_mux->need_segment = TRUE;
+      gst_tensor_time_sync_reset (&tensor_mux->sync);
       break;
     default:
       break;
@@ -355,6 +405,21 @@ gst_tensor_mux_collect_buffer (GstTensorMux * tensor_mux,
   return isEOS;
 }
 
+/**
+ * @brief Clip function of collect pads, called with the incoming buffer of each pad.
+ * In refresh mode, it keeps the buffers of the pads except the base pad, and makes the tensors if the base pad is stalled.
+ */
+static GstFlowReturn
+gst_tensor_mux_clip (GstCollectPads * pads, GstCollectData * data,
+    GstBuffer * inbuf, GstBuffer ** outbuf, GstTensorMux * tensor_mux)
+{
+  if (gst_tensor_time_sync_clip (pads, &tensor_mux->sync, data, inbuf,
+          outbuf))
+    return gst_tensor_mux_collected (pads, tensor_mux);
+
+  return GST_FLOW_OK;
+}
+
 /**
  * @brief Gst Collect Pads Function which is called once collect pads done.
  * @param pads GstCollectPads
@@ -464,6 +529,8 @@ gst_tensor_mux_ready_to_paused (GstTensorMux * tensor_mux)
   tensor_mux->need_stream_start = TRUE;
   tensor_mux->need_segment = TRUE;
   tensor_mux->negotiated = FALSE;
+  gst_tensor_time_sync_reset (&tensor_mux->sync);
+  gst_tensor_time_sync_set_pad_waiting (tensor_mux->collect, &tensor_mux->sync);
   gst_collect_pads_start (tensor_mux->collect);
 }
 
@@ -521,11 +588,20 @@ gst_tensor_mux_set_property (GObject * object, guint prop_id,
       silent_debug ("Mode = %d(%s)\n", filter->sync.mode,
           gst_tensor_time_sync_get_mode_string (filter->sync.mode));
       gst_tensor_time_sync_set_option_data (&filter->sync);
+      gst_tensor_time_sync_set_pad_waiting (filter->collect, &filter->sync);
       break;
     case PROP_SYNC_OPTION:
       filter->sync.option = g_value_dup_string (value);
       silent_debug ("Option = %s\n", filter->sync.option);
       gst_tensor_time_sync_set_option_data (&filter->sync);
+      gst_tensor_time_sync_set_pad_waiting (filter->collect, &filter->sync);
+      break;
+    case PROP_LATENCY:
+      filter->sync.latency = g_value_get_uint64 (value);
+      silent_debug ("Latency = %" GST_TIME_FORMAT "\n",
+          GST_TIME_ARGS (filter->sync.latency));
+      gst_element_post_message (GST_ELEMENT (filter),
+          gst_message_new_latency (GST_OBJECT (filter)));
       break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -552,6 +628,9 @@ gst_tensor_mux_get_property (GObject * object, guint prop_id,
     case PROP_SYNC_OPTION:
       g_value_set_string (value, filter->sync.option);
       break;
+    case PROP_LATENCY:
+      g_value_set_uint64 (value, filter->sync.latency);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -165,15 +165,15 @@ gst_tensor_repo_set_changed (guint o_nth, guint nth, gboolean is_sink)
         GST_DEBUG ("SET sink_changed! @id %d \n", o_nth);
 
       /* signal pull */
-      g_cond_signal (&data->cond_pull);
+      g_cond_broadcast (&data->cond_pull);
     } else {
       data->src_changed = TRUE;
       data->src_id = nth;
       if (DBG)
         GST_DEBUG ("SET src_changed! @id %d\n", o_nth);
 
-      /* signal push */
-      g_cond_signal (&data->cond_push);
+      /* signal push, wake up all readers (broadcast) */
+      g_cond_broadcast (&data->cond_push);
     }
 
     g_mutex_unlock (&data->lock);
@@ -183,6 +183,162 @@ gst_tensor_repo_set_changed (guint o_nth, guint nth, gboolean is_sink)
   return FALSE;
 }
 
+/**
+ * @brief Pop the oldest buffer from the ring of slot. Caller should hold the lock of slot.
+ */
+static GstBuffer *
+gst_tensor_repo_pop_buffer (GstTensorRepoData * data)
+{
+  GstBuffer *buf;
+
+  if (data->num_buffers == 0)
+    return NULL;
+
+  buf = data->buffers[data->head];
+  data->buffers[data->head] = NULL;
+  data->head = (data->head + 1) % data->depth;
+  data->num_buffers--;
+  data->first_seq++;
+
+  return buf;
+}
+
+/**
+ * @brief Clear the buffers in the ring of slot. Caller should hold the lock of slot.
+ */
+static void
+gst_tensor_repo_clear_buffers (GstTensorRepoData * data)
+{
+  GstBuffer *buf;
+
+  while ((buf = gst_tensor_repo_pop_buffer (data)) != NULL)
+    gst_buffer_unref (buf);
+
+  data->head = 0;
+}
+
+/**
+ * @brief Remove the buffers which all readers have read (broadcast). Caller should hold the lock of slot.
+ */
+static void
+gst_tensor_repo_trim_buffers (GstTensorRepoData * data)
+{
+  GHashTableIter iter;
+  gpointer value;
+  guint64 min_cursor = G_MAXUINT64;
+
+  /* keep the buffers until a reader is added */
+  if (g_hash_table_size (data->readers) == 0)
+    return;
+
+  g_hash_table_iter_init (&iter, data->readers);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    GstTensorRepoReader *reader = (GstTensorRepoReader *) value;
+
+    min_cursor = MIN (min_cursor, reader->cursor);
+  }
+
+  while (data->num_buffers > 0 && data->first_seq < min_cursor)
+    gst_buffer_unref (gst_tensor_repo_pop_buffer (data));
+}
+
+/**
+ * @brief Move the cursor of the readers which are behind the lag limit (broadcast). Caller should hold the lock of slot.
+ * @param next_seq sequence number of the next buffer to be pushed
+ * @note The lag limit larger than the depth of slot works as the depth, so that the reader does not block reposink.
+ */
+static void
+gst_tensor_repo_update_readers (GstTensorRepoData * data, guint64 next_seq)
+{
+  GHashTableIter iter;
+  gpointer value;
+  guint max_lag;
+
+  g_hash_table_iter_init (&iter, data->readers);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    GstTensorRepoReader *reader = (GstTensorRepoReader *) value;
+
+    /* the buffers are dropped */
+    if (reader->cursor < data->first_seq)
+      reader->cursor = data->first_seq;
+
+    if (reader->max_lag == 0)
+      continue;
+
+    /* skip the old buffers, the reader is too slow */
+    max_lag = MIN (reader->max_lag, data->depth);
+    if (next_seq - reader->cursor > max_lag)
+      reader->cursor = next_seq - max_lag;
+  }
+}
+
+/**
+ * @brief Read the buffer at the cursor of reader (broadcast). Caller should hold the lock of slot.
+ */
+static GstBuffer *
+gst_tensor_repo_read_buffer (guint nth, GstTensorRepoData * data,
+    gpointer reader_id, guint max_lag, gboolean * eos)
+{
+  GstTensorRepoReader *reader;
+  GstBuffer *buf;
+  guint64 next_seq;
+  gboolean was_full;
+
+  while (TRUE) {
+    if (!data->broadcast)
+      return NULL;
+
+    reader = (GstTensorRepoReader *) g_hash_table_lookup (data->readers,
+        reader_id);
+    if (reader == NULL) {
+      /* the reader is removed when reposrc changes the slot */
+      if (data->src_changed)
+        return NULL;
+
+      /* reposrc has not been added to the slot (e.g., default slot-index) */
+      reader = g_new0 (GstTensorRepoReader, 1);
+      reader->cursor = data->first_seq;
+      g_hash_table_insert (data->readers, reader_id, reader);
+    }
+
+    reader->max_lag = max_lag;
+
+    next_seq = data->first_seq + data->num_buffers;
+    gst_tensor_repo_update_readers (data, next_seq);
+
+    if (reader->cursor < next_seq)
+      break;
+
+    if (data->eos) {
+      *eos = TRUE;
+      return NULL;
+    }
+
+    /* wait push */
+    g_cond_wait (&data->cond_push, &data->lock);
+  }
+
+  /* the readers share the memories of the buffer */
+  buf = gst_buffer_copy (data->buffers[(data->head + (reader->cursor -
+                  data->first_seq)) % data->depth]);
+  reader->cursor++;
+
+  if (DBG) {
+    unsigned long size = gst_buffer_get_size (buf);
+    GST_DEBUG ("Read [ %d ] (size: %lu, cursor: %" G_GUINT64_FORMAT ")\n",
+        nth, size, reader->cursor);
+  }
+
+  was_full = (data->num_buffers >= data->depth);
+  gst_tensor_repo_trim_buffers (data);
+
+  /* signal pull, reposink waits only if the ring is full */
+  if (was_full && data->num_buffers < data->depth)
+    g_cond_signal (&data->cond_pull);
+
+  return buf;
+}
+
 /**
  * @brief Add GstTensorRepoData into repo.
  */
@@ -213,7 +369,15 @@ gst_tensor_repo_add_repodata (guint nth, gboolean is_sink)
 
   data = g_new (GstTensorRepoData, 1);
   data->eos = FALSE;
-  data->buffer = NULL;
+  data->depth = GST_TENSOR_REPO_DEFAULT_DEPTH;
+  data->buffers = g_new0 (GstBuffer *, data->depth);
+  data->head = 0;
+  data->num_buffers = 0;
+  data->drop_oldest = FALSE;
+  data->first_seq = 0;
+  data->broadcast = FALSE;
+  data->readers = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL,
+      g_free);
   g_cond_init (&data->cond_push);
   g_cond_init (&data->cond_pull);
   g_mutex_init (&data->lock);
@@ -236,6 +400,144 @@ gst_tensor_repo_add_repodata (guint nth, gboolean is_sink)
   return ret;
 }
 
+/**
+ * @brief Set the number of buffers in the slot and the policy when the slot is full.
+ */
+gboolean
+gst_tensor_repo_set_depth (guint nth, guint depth, gboolean drop_oldest)
+{
+  GstTensorRepoData *data;
+  GstBuffer **ring;
+  guint i;
+
+  g_return_val_if_fail (depth > 0 && depth <= GST_TENSOR_REPO_MAX_DEPTH,
+      FALSE);
+
+  data = gst_tensor_repo_get_repodata (nth);
+
+  g_return_val_if_fail (data != NULL, FALSE);
+
+  g_mutex_lock (&data->lock);
+
+  if (data->depth != depth) {
+    /* keep the latest buffers */
+    while (data->num_buffers > depth)
+      gst_buffer_unref (gst_tensor_repo_pop_buffer (data));
+
+    ring = g_new0 (GstBuffer *, depth);
+    for (i = 0; i < data->num_buffers; i++)
+      ring[i] = data->buffers[(data->head + i) % data->depth];
+
+    g_free (data->buffers);
+    data->buffers = ring;
+    data->depth = depth;
+    data->head = 0;
+
+    /* reposink may push more buffers */
+    g_cond_broadcast (&data->cond_pull);
+  }
+
+  data->drop_oldest = drop_oldest;
+
+  if (DBG)
+    GST_DEBUG ("Set depth [%d] : %u (drop-oldest %d)\n", nth, depth,
+        drop_oldest);
+
+  g_mutex_unlock (&data->lock);
+  return TRUE;
+}
+
+/**
+ * @brief Set the broadcast mode of the slot.
+ */
+gboolean
+gst_tensor_repo_set_broadcast (guint nth, gboolean broadcast)
+{
+  GstTensorRepoData *data;
+  GHashTableIter iter;
+  gpointer value;
+
+  data = gst_tensor_repo_get_repodata (nth);
+
+  g_return_val_if_fail (data != NULL, FALSE);
+
+  g_mutex_lock (&data->lock);
+
+  if (data->broadcast != broadcast) {
+    data->broadcast = broadcast;
+
+    /* the readers start from the oldest buffer in the slot */
+    g_hash_table_iter_init (&iter, data->readers);
+    while (g_hash_table_iter_next (&iter, NULL, &value))
+      ((GstTensorRepoReader *) value)->cursor = data->first_seq;
+
+    g_cond_broadcast (&data->cond_push);
+    g_cond_broadcast (&data->cond_pull);
+  }
+
+  g_mutex_unlock (&data->lock);
+  return TRUE;
+}
+
+/**
+ * @brief Add the reader (reposrc) of the slot.
+ */
+gboolean
+gst_tensor_repo_add_reader (guint nth, gpointer reader_id)
+{
+  GstTensorRepoData *data;
+  GstTensorRepoReader *reader;
+
+  data = gst_tensor_repo_get_repodata (nth);
+
+  g_return_val_if_fail (data != NULL, FALSE);
+
+  g_mutex_lock (&data->lock);
+
+  if (!g_hash_table_contains (data->readers, reader_id)) {
+    reader = g_new0 (GstTensorRepoReader, 1);
+    reader->cursor = data->first_seq;
+    g_hash_table_insert (data->readers, reader_id, reader);
+  }
+
+  g_mutex_unlock (&data->lock);
+  return TRUE;
+}
+
+/**
+ * @brief Remove the reader (reposrc) of the slot.
+ */
+guint
+gst_tensor_repo_remove_reader (guint nth, gpointer reader_id)
+{
+  GstTensorRepoData *data;
+  gboolean was_full;
+  guint remained;
+
+  data = gst_tensor_repo_get_repodata (nth);
+
+  if (data == NULL)
+    return 0;
+
+  g_mutex_lock (&data->lock);
+
+  if (g_hash_table_remove (data->readers, reader_id) && data->broadcast) {
+    was_full = (data->num_buffers >= data->depth);
+    gst_tensor_repo_trim_buffers (data);
+
+    if (was_full && data->num_buffers < data->depth)
+      g_cond_broadcast (&data->cond_pull);
+  }
+
+  remained = g_hash_table_size (data->readers);
+
+  /* wake up the reader waiting in the slot */
+  g_cond_broadcast (&data->cond_push);
+
+  g_mutex_unlock (&data->lock);
+  return remained;
+}
+
 /**
  * @brief Push GstBuffer into repo.
  */
@@ -245,6 +547,8 @@ gst_tensor_repo_set_buffer (guint nth, guint o_nth, GstBuffer * buffer,
 {
   GstTensorRepoData *data;
   GstMetaRepo *meta;
+  GstBuffer *buf;
+  gboolean was_empty;
 
   data = gst_tensor_repo_get_repodata (nth);
 
@@ -252,7 +556,18 @@ gst_tensor_repo_set_buffer (guint nth, guint o_nth, GstBuffer * buffer,
 
   g_mutex_lock (&data->lock);
 
-  while (data->buffer != NULL && !data->eos) {
+  if (data->broadcast) {
+    /* the readers behind the lag limit skip the old buffers */
+    gst_tensor_repo_update_readers (data,
+        data->first_seq + data->num_buffers + 1);
+    gst_tensor_repo_trim_buffers (data);
+  }
+
+  while (data->num_buffers >= data->depth && !data->drop_oldest && !data->eos) {
+    /* no reader to wait for */
+    if (data->broadcast && g_hash_table_size (data->readers) == 0)
+      break;
+
     /* wait pull */
     g_cond_wait (&data->cond_pull, &data->lock);
   }
@@ -262,19 +577,36 @@ gst_tensor_repo_set_buffer (guint nth, guint o_nth, GstBuffer * buffer,
     return FALSE;
   }
 
-  data->buffer = gst_buffer_copy (buffer);
+  if (data->num_buffers >= data->depth) {
+    /* drop the oldest buffer, reposrc is slower than reposink */
+    gst_buffer_unref (gst_tensor_repo_pop_buffer (data));
 
-  meta = GST_META_REPO_ADD (data->buffer);
+    if (DBG)
+      GST_DEBUG ("Dropped the oldest buffer [%d]\n", nth);
+  }
+
+  buf = gst_buffer_copy (buffer);
+
+  meta = GST_META_REPO_ADD (buf);
 
   gst_caps_replace (&meta->caps, caps);
 
+  was_empty = (data->num_buffers == 0);
+  data->buffers[(data->head + data->num_buffers) % data->depth] = buf;
+  data->num_buffers++;
+
   if (DBG) {
-    unsigned long size = gst_buffer_get_size (data->buffer);
+    unsigned long size = gst_buffer_get_size (buf);
     GST_DEBUG ("Pushed [%d] (size : %lu)\n", nth, size);
   }
 
-  /* signal push */
-  g_cond_signal (&data->cond_push);
+  if (data->broadcast) {
+    /* signal push, each reader waits for the next buffer at its own cursor */
+    g_cond_broadcast (&data->cond_push);
+  } else if (was_empty) {
+    /* signal push, reposrc waits only if the ring is empty */
+    g_cond_signal (&data->cond_push);
+  }
 
   g_mutex_unlock (&data->lock);
   return TRUE;
@@ -346,8 +678,10 @@ gst_tensor_repo_set_eos (guint nth)
   g_mutex_lock (&data->lock);
 
   data->eos = TRUE;
-  g_cond_signal (&data->cond_push);
-  g_cond_signal (&data->cond_pull);
+
+  /* wake up all readers (broadcast) and reposink */
+  g_cond_broadcast (&data->cond_push);
+  g_cond_broadcast (&data->cond_pull);
 
   g_mutex_unlock (&data->lock);
   return TRUE;
@@ -357,11 +691,13 @@ gst_tensor_repo_set_eos (guint nth)
  * @brief Get GstTensorRepoData from repo.
  */
 GstBuffer *
-gst_tensor_repo_get_buffer (guint nth, guint o_nth, gboolean * eos,
-    guint * newid)
+gst_tensor_repo_get_buffer (guint nth, guint o_nth, gpointer reader_id,
+    guint max_lag, gboolean * eos, guint * newid)
 {
   GstTensorRepoData *data;
   GstBuffer *buf = NULL;
+  GstBuffer *popped;
+  gboolean was_full;
 
   data = gst_tensor_repo_get_repodata (nth);
 
@@ -369,7 +705,12 @@ gst_tensor_repo_get_buffer (guint nth, guint o_nth, gboolean * eos,
 
   g_mutex_lock (&data->lock);
 
-  while (!data->buffer) {
+  if (data->broadcast) {
+    buf = gst_tensor_repo_read_buffer (nth, data, reader_id, max_lag, eos);
+    goto done;
+  }
+
+  while (data->num_buffers == 0) {
     if (gst_tensor_repo_check_changed (nth, newid, FALSE)) {
       buf = NULL;
       goto done;
@@ -385,17 +726,21 @@ gst_tensor_repo_get_buffer (guint nth, guint o_nth, gboolean * eos,
     g_cond_wait (&data->cond_push, &data->lock);
   }
 
-  buf = gst_buffer_copy_deep (data->buffer);
-  gst_buffer_unref (data->buffer);
+  was_full = (data->num_buffers >= data->depth);
+  popped = gst_tensor_repo_pop_buffer (data);
+
+  buf = gst_buffer_copy_deep (popped);
+  gst_buffer_unref (popped);
   if (DBG) {
     unsigned long size = gst_buffer_get_size (buf);
     GST_DEBUG ("Popped [ %d ] (size: %lu)\n", nth, size);
   }
 
+  /* signal pull, reposink waits only if the ring is full */
+  if (was_full)
+    g_cond_signal (&data->cond_pull);
+
 done:
-  data->buffer = NULL;
-  /* signal pull */
-  g_cond_signal (&data->cond_pull);
   g_mutex_unlock (&data->lock);
   return buf;
 }
@@ -415,6 +760,14 @@ gst_tensor_repo_remove_repodata (guint nth)
   data = gst_tensor_repo_get_repodata (nth);
 
   if (data) {
+    g_mutex_lock (&data->lock);
+    gst_tensor_repo_clear_buffers (data);
+    g_free (data->buffers);
+    data->buffers = NULL;
+    g_hash_table_destroy (data->readers);
+    data->readers = NULL;
+    g_mutex_unlock (&data->lock);
+
     g_mutex_clear (&data->lock);
     g_cond_clear (&data->cond_pull);
     g_cond_clear (&data->cond_push);
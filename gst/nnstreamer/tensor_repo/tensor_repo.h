@@ -70,14 +70,43 @@ GstMetaRepo *gst_buffer_add_meta_repo (GstBuffer * buffer);
 #define GST_META_REPO_GET(buf) ((GstMetaRepo*) gst_buffer_get_meta_repo(buf))
 #define GST_META_REPO_ADD(buf) ((GstMetaRepo*) gst_buffer_add_meta_repo(buf))
 
+/**
+ * @brief Default number of buffers in a slot.
+ */
+#define GST_TENSOR_REPO_DEFAULT_DEPTH (1U)
+
+/**
+ * @brief Max number of buffers in a slot.
+ */
+#define GST_TENSOR_REPO_MAX_DEPTH (1024U)
+
+/**
+ * @brief Reader of the repository slot (tensor_reposrc).
+ *
+ * In broadcast mode, each reader reads the buffers in the slot at its own cursor.
+ */
+typedef struct
+{
+  guint64 cursor; /**< sequence number of the next buffer to read */
+  guint max_lag; /**< max number of buffers behind the latest one (0 for no limit) */
+} GstTensorRepoReader;
+
 /**
  * @brief GstTensorRepo internal data structure.
  *
  * GstTensorRepo has GSlist of GstTensorRepoData.
+ * Each slot keeps the buffers in a bounded ring, so reposink does not wait for reposrc until the ring is full.
  */
 typedef struct
 {
-  GstBuffer *buffer;
+  GstBuffer **buffers; /**< ring of the buffers pushed into the slot */
+  guint depth; /**< max number of buffers in the ring (slot-depth) */
+  guint head; /**< index of the oldest buffer in the ring */
+  guint num_buffers; /**< the number of buffers in the ring */
+  gboolean drop_oldest; /**< drop the oldest buffer if the ring is full, otherwise reposink waits for reposrc */
+  guint64 first_seq; /**< sequence number of the oldest buffer in the ring */
+  gboolean broadcast; /**< every reader reads all buffers, the buffers are kept until all readers read them */
+  GHashTable *readers; /**< readers of the slot (key: reposrc, value: GstTensorRepoReader) */
   GCond cond_push;
   GCond cond_pull;
   GMutex lock;
@@ -113,6 +142,31 @@ gst_tensor_repo_get_repodata (guint nth);
 gboolean
 gst_tensor_repo_add_repodata (guint myid, gboolean is_sink);
 
+/**
+ * @brief Set the number of buffers in the slot and the policy when the slot is full.
+ */
+gboolean
+gst_tensor_repo_set_depth (guint nth, guint depth, gboolean drop_oldest);
+
+/**
+ * @brief Set the broadcast mode of the slot.
+ */
+gboolean
+gst_tensor_repo_set_broadcast (guint nth, gboolean broadcast);
+
+/**
+ * @brief Add the reader (reposrc) of the slot.
+ */
+gboolean
+gst_tensor_repo_add_reader (guint nth, gpointer reader_id);
+
+/**
+ * @brief Remove the reader (reposrc) of the slot.
+ * @return the number of remaining readers
+ */
+guint
+gst_tensor_repo_remove_reader (guint nth, gpointer reader_id);
+
 /**
  * @brief Push GstBuffer into repo.
  */
@@ -141,7 +195,7 @@ gst_tensor_repo_set_changed (guint o_nth, guint nth, gboolean is_sink);
  * @brief Get GstTensorRepoData from repo.
  */
 GstBuffer *
-gst_tensor_repo_get_buffer (guint nth, guint o_nth, gboolean *eos, guint *newid);
+gst_tensor_repo_get_buffer (guint nth, guint o_nth, gpointer reader_id, guint max_lag, gboolean *eos, guint *newid);
 
 /**
  * @brief Check repo data is changed.
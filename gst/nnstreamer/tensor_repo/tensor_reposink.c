@@ -46,13 +46,19 @@ enum
   PROP_0,
   PROP_SIGNAL_RATE,
   PROP_SLOT,
-  PROP_SILENT
+  PROP_SILENT,
+  PROP_SLOT_DEPTH,
+  PROP_DROP_OLDEST,
+  PROP_BROADCAST
 };
 
 #define DEFAULT_SIGNAL_RATE 0
 #define DEFAULT_SILENT TRUE
 #define DEFAULT_QOS TRUE
 #define DEFAULT_INDEX 0
+#define DEFAULT_SLOT_DEPTH GST_TENSOR_REPO_DEFAULT_DEPTH
+#define DEFAULT_DROP_OLDEST FALSE
+#define DEFAULT_BROADCAST FALSE
 
 /**
  * @brief tensor_reposink sink template
@@ -121,6 +127,41 @@ gst_tensor_reposink_class_init (GstTensorRepoSinkClass * klass)
       g_param_spec_boolean ("silent", "Silent", "Produce verbose output",
           DEFAULT_SILENT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorRepoSink::slot-depth:
+   *
+   * The max number of buffers in the repository slot.
+   * With the default (1), reposink waits until reposrc pops the buffer.
+   * Larger depth decouples reposink and reposrc, the buffers are kept in order.
+   */
+  g_object_class_install_property (gobject_class, PROP_SLOT_DEPTH,
+      g_param_spec_uint ("slot-depth", "Slot Depth",
+          "The max number of buffers in the repository slot",
+          1, GST_TENSOR_REPO_MAX_DEPTH, DEFAULT_SLOT_DEPTH,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorRepoSink::drop-oldest:
+   *
+   * If TRUE, the oldest buffer in the slot is dropped when the slot is full.
+   * Otherwise, reposink waits until reposrc pops the buffer.
+   */
+  g_object_class_install_property (gobject_class, PROP_DROP_OLDEST,
+      g_param_spec_boolean ("drop-oldest", "Drop oldest",
+          "Drop the oldest buffer when the repository slot is full",
+          DEFAULT_DROP_OLDEST, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorRepoSink::broadcast:
+   *
+   * If TRUE, every tensor_reposrc with the same slot-index reads all buffers at its own cursor.
+   * The buffers are kept in the slot until all readers read them (see max-lag of tensor_reposrc).
+   */
+  g_object_class_install_property (gobject_class, PROP_BROADCAST,
+      g_param_spec_boolean ("broadcast", "Broadcast",
+          "Push the buffers to all tensor_reposrc with the same slot-index",
+          DEFAULT_BROADCAST, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (element_class,
       "TensorRepoSink",
       "Set/TensorRepo",
@@ -159,10 +200,35 @@ gst_tensor_reposink_init (GstTensorRepoSink * self)
   self->last_render_time = GST_CLOCK_TIME_NONE;
   self->set_startid = FALSE;
   self->in_caps = NULL;
+  self->slot_depth = DEFAULT_SLOT_DEPTH;
+  self->drop_oldest = DEFAULT_DROP_OLDEST;
+  self->broadcast = DEFAULT_BROADCAST;
 
   gst_base_sink_set_qos_enabled (basesink, DEFAULT_QOS);
 }
 
+/**
+ * @brief Update the number of buffers and the policy of repository slot.
+ */
+static void
+gst_tensor_reposink_update_slot (GstTensorRepoSink * self)
+{
+  /* slot is not configured yet */
+  if (!self->set_startid)
+    return;
+
+  if (!gst_tensor_repo_set_depth (self->myid, self->slot_depth,
+          self->drop_oldest)) {
+    GST_WARNING_OBJECT (self, "Cannot set the depth of repo [key: %d]",
+        self->myid);
+  }
+
+  if (!gst_tensor_repo_set_broadcast (self->myid, self->broadcast)) {
+    GST_WARNING_OBJECT (self, "Cannot set the broadcast of repo [key: %d]",
+        self->myid);
+  }
+}
+
 /**
  * @brief set property vmethod
  */
@@ -192,9 +258,23 @@ gst_tensor_reposink_set_property (GObject * object, guint prop_id,
         self->set_startid = TRUE;
       }
 
+      gst_tensor_reposink_update_slot (self);
+
       if (self->o_myid != self->myid)
         gst_tensor_repo_set_changed (self->o_myid, self->myid, TRUE);
       break;
+    case PROP_SLOT_DEPTH:
+      self->slot_depth = g_value_get_uint (value);
+      gst_tensor_reposink_update_slot (self);
+      break;
+    case PROP_DROP_OLDEST:
+      self->drop_oldest = g_value_get_boolean (value);
+      gst_tensor_reposink_update_slot (self);
+      break;
+    case PROP_BROADCAST:
+      self->broadcast = g_value_get_boolean (value);
+      gst_tensor_reposink_update_slot (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -222,6 +302,15 @@ gst_tensor_reposink_get_property (GObject * object, guint prop_id,
     case PROP_SLOT:
       g_value_set_uint (value, self->myid);
       break;
+    case PROP_SLOT_DEPTH:
+      g_value_set_uint (value, self->slot_depth);
+      break;
+    case PROP_DROP_OLDEST:
+      g_value_set_boolean (value, self->drop_oldest);
+      break;
+    case PROP_BROADCAST:
+      g_value_set_boolean (value, self->broadcast);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
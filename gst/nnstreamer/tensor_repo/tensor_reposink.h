@@ -62,6 +62,9 @@ struct _GstTensorRepoSink
   gboolean set_startid;
   guint myid;
   guint o_myid;
+  guint slot_depth; /**< the max number of buffers in the slot */
+  gboolean drop_oldest; /**< drop the oldest buffer if the slot is full */
+  gboolean broadcast; /**< push the buffers to all readers of the slot */
 };
 
 /**
@@ -48,11 +48,13 @@ enum
   PROP_0,
   PROP_CAPS,
   PROP_SLOT_ID,
-  PROP_SILENT
+  PROP_SILENT,
+  PROP_MAX_LAG
 };
 
 #define DEFAULT_SILENT TRUE
 #define DEFAULT_INDEX 0
+#define DEFAULT_MAX_LAG 0
 
 /**
  * @brief tensor_reposrc src template
@@ -68,6 +70,7 @@ static void gst_tensor_reposrc_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
 static void gst_tensor_reposrc_dispose (GObject * object);
 static GstCaps *gst_tensor_reposrc_getcaps (GstBaseSrc * src, GstCaps * filter);
+static gboolean gst_tensor_reposrc_start (GstBaseSrc * src);
 static GstFlowReturn gst_tensor_reposrc_create (GstPushSrc * src,
     GstBuffer ** buffer);
 
@@ -106,7 +109,22 @@ gst_tensor_reposrc_class_init (GstTensorRepoSrcClass * klass)
           0, UINT_MAX, DEFAULT_INDEX,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorRepoSrc::max-lag:
+   *
+   * The max number of buffers behind the latest one in broadcast mode (see broadcast of tensor_reposink).
+   * If tensor_reposrc is slower than this, the old buffers are skipped and tensor_reposink does not wait for it.
+   * 0 means no limit, tensor_reposink waits for the slowest reader unless drop-oldest is set.
+   * The value larger than slot-depth of tensor_reposink works as slot-depth.
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_LAG,
+      g_param_spec_uint ("max-lag", "Max lag",
+          "The max number of buffers behind the latest one in broadcast mode "
+          "(0 for no limit)", 0, GST_TENSOR_REPO_MAX_DEPTH, DEFAULT_MAX_LAG,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   basesrc_class->get_caps = gst_tensor_reposrc_getcaps;
+  basesrc_class->start = gst_tensor_reposrc_start;
   pushsrc_class->create = gst_tensor_reposrc_create;
 
   gst_element_class_set_static_metadata (element_class,
@@ -130,6 +148,7 @@ gst_tensor_reposrc_init (GstTensorRepoSrc * self)
   gst_tensors_config_init (&self->config);
   self->caps = NULL;
   self->set_startid = FALSE;
+  self->max_lag = DEFAULT_MAX_LAG;
 }
 
 /**
@@ -140,7 +159,9 @@ gst_tensor_reposrc_dispose (GObject * object)
 {
   GstTensorRepoSrc *self = GST_TENSOR_REPOSRC (object);
 
-  if (!gst_tensor_repo_remove_repodata (self->myid))
+  /* the slot is removed when the last reader is disposed */
+  if (gst_tensor_repo_remove_reader (self->myid, self) == 0 &&
+      !gst_tensor_repo_remove_repodata (self->myid))
     GST_ELEMENT_ERROR (self, RESOURCE, WRITE,
         ("Cannot remove [key: %d] in repo", self->myid), NULL);
 
@@ -150,6 +171,29 @@ gst_tensor_reposrc_dispose (GObject * object)
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
+/**
+ * @brief start vmethod of tensor_reposrc
+ */
+static gboolean
+gst_tensor_reposrc_start (GstBaseSrc * src)
+{
+  GstTensorRepoSrc *self = GST_TENSOR_REPOSRC (src);
+
+  gst_tensor_repo_init ();
+
+  /* add the reader of current slot, slot-index may not be set */
+  if (gst_tensor_repo_get_repodata (self->myid) == NULL)
+    gst_tensor_repo_add_repodata (self->myid, FALSE);
+
+  if (!gst_tensor_repo_add_reader (self->myid, self)) {
+    GST_ERROR_OBJECT (self, "Cannot add the reader of repo [key: %d]",
+        self->myid);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief get cap of tensor_reposrc
  */
@@ -216,8 +260,16 @@ gst_tensor_reposrc_set_property (GObject * object, guint prop_id,
         self->set_startid = TRUE;
       }
 
-      if (self->o_myid != self->myid)
+      gst_tensor_repo_add_reader (self->myid, self);
+
+      if (self->o_myid != self->myid) {
+        /* set the changing status first, the reader waiting in old slot returns */
         gst_tensor_repo_set_changed (self->o_myid, self->myid, FALSE);
+        gst_tensor_repo_remove_reader (self->o_myid, self);
+      }
+      break;
+    case PROP_MAX_LAG:
+      self->max_lag = g_value_get_uint (value);
       break;
     case PROP_CAPS:
     {
@@ -268,6 +320,9 @@ gst_tensor_reposrc_get_property (GObject * object, guint prop_id,
     case PROP_SLOT_ID:
       g_value_set_uint (value, self->myid);
       break;
+    case PROP_MAX_LAG:
+      g_value_set_uint (value, self->max_lag);
+      break;
     case PROP_CAPS:
       gst_value_set_caps (value, self->caps);
       break;
@@ -326,7 +381,8 @@ gst_tensor_reposrc_create (GstPushSrc * src, GstBuffer ** buffer)
     self->ini = TRUE;
   } else {
     while (!buf && !eos) {
-      buf = gst_tensor_repo_get_buffer (self->myid, self->o_myid, &eos, &newid);
+      buf = gst_tensor_repo_get_buffer (self->myid, self->o_myid, self,
+          self->max_lag, &eos, &newid);
     }
 
     if (eos)
@@ -64,6 +64,7 @@ struct _GstTensorRepoSrc
   gint fps_d;
   gboolean negotiation;
   gboolean set_startid;
+  guint max_lag; /**< max number of buffers behind the latest one in broadcast mode */
 };
 
 /**
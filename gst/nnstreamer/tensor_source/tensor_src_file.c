@@ -0,0 +1,602 @@
+/**
+ * GStreamer / NNStreamer tensor_src_file
+ * Copyright (C) 2019 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ */
+
+/**
+ * SECTION:element-tensor_src_file
+ *
+ * Source element to replay the tensor frames in a file (e.g., a dataset dumped by filesink).
+ * The file is memory-mapped and each tensor is pushed as a read-only memory wrapping the mapped region, without copying the data.
+ *
+ * The file is either of
+ * <itemizedlist>
+ *   <listitem><para>Raw tensor frames. The property caps is required.</para></listitem>
+ *   <listitem><para>Tensor frames with the header ("NNSTDUMP", version, header size and caps string). See tensor_src_file.h for the layout.</para></listitem>
+ * </itemizedlist>
+ *
+ * If the framerate of caps is given, the timestamp of each frame is set with the framerate and the sink renders the frames at the rate.
+ * With framerate 0/1 (default if not given), the frames are pushed without timestamp as fast as possible.
+ *
+ * <refsect2>
+ * <title>Example launch line</title>
+ * |[
+ * gst-launch-1.0 tensor_src_file location=dataset.raw loop=true \
+ *     caps="other/tensor,dimension=(string)3:224:224:1,type=(string)uint8,framerate=(fraction)30/1" ! \
+ *     tensor_filter framework=tensorflow-lite model=model.tflite ! tensor_sink
+ * ]|
+ * </refsect2>
+ *
+ * @file	tensor_src_file.c
+ * @date	18 Oct 2019
+ * @brief	GStreamer plugin to replay the tensor frames in a file (memory-mapped)
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include "tensor_src_file.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_tensor_src_file_debug);
+#define GST_CAT_DEFAULT gst_tensor_src_file_debug
+#define CAPS_STRING GST_TENSOR_CAP_DEFAULT "; " GST_TENSORS_CAP_DEFAULT
+
+/**
+ * @brief The size of fixed fields in the header (magic, version and header size).
+ */
+#define TENSOR_FILE_HEADER_MIN (16)
+
+/**
+ * @brief tensor_src_file properties
+ */
+enum
+{
+  PROP_0,
+  PROP_LOCATION,
+  PROP_CAPS,
+  PROP_LOOP,
+  PROP_SILENT
+};
+
+#define DEFAULT_SILENT TRUE
+#define DEFAULT_LOOP FALSE
+
+/**
+ * @brief tensor_src_file src template
+ */
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (CAPS_STRING));
+
+static void gst_tensor_src_file_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_tensor_src_file_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+static void gst_tensor_src_file_finalize (GObject * object);
+static gboolean gst_tensor_src_file_start (GstBaseSrc * src);
+static gboolean gst_tensor_src_file_stop (GstBaseSrc * src);
+static GstCaps *gst_tensor_src_file_get_caps (GstBaseSrc * src,
+    GstCaps * filter);
+static gboolean gst_tensor_src_file_is_seekable (GstBaseSrc * src);
+static GstFlowReturn gst_tensor_src_file_create (GstPushSrc * src,
+    GstBuffer ** buffer);
+
+#define gst_tensor_src_file_parent_class parent_class
+G_DEFINE_TYPE (GstTensorSrcFile, gst_tensor_src_file, GST_TYPE_PUSH_SRC);
+
+/**
+ * @brief class initialization of tensor_src_file
+ */
+static void
+gst_tensor_src_file_class_init (GstTensorSrcFileClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstPushSrcClass *pushsrc_class = GST_PUSH_SRC_CLASS (klass);
+  GstBaseSrcClass *basesrc_class = GST_BASE_SRC_CLASS (klass);
+
+  GST_DEBUG_CATEGORY_INIT (gst_tensor_src_file_debug, "tensor_src_file", 0,
+      "Source element to replay the tensor frames in a file");
+
+  gobject_class->set_property = gst_tensor_src_file_set_property;
+  gobject_class->get_property = gst_tensor_src_file_get_property;
+  gobject_class->finalize = gst_tensor_src_file_finalize;
+
+  g_object_class_install_property (gobject_class, PROP_LOCATION,
+      g_param_spec_string ("location", "File Location",
+          "Location of the tensor file to read", NULL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_CAPS,
+      g_param_spec_boxed ("caps", "Caps",
+          "Caps describing the tensors in the file "
+          "(required for raw file, overrides the caps in the header)",
+          GST_TYPE_CAPS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_LOOP,
+      g_param_spec_boolean ("loop", "Loop",
+          "Repeat the frames from the beginning at the end of file",
+          DEFAULT_LOOP, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_SILENT,
+      g_param_spec_boolean ("silent", "Silent", "Produce verbose output",
+          DEFAULT_SILENT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  basesrc_class->start = GST_DEBUG_FUNCPTR (gst_tensor_src_file_start);
+  basesrc_class->stop = GST_DEBUG_FUNCPTR (gst_tensor_src_file_stop);
+  basesrc_class->get_caps = GST_DEBUG_FUNCPTR (gst_tensor_src_file_get_caps);
+  basesrc_class->is_seekable =
+      GST_DEBUG_FUNCPTR (gst_tensor_src_file_is_seekable);
+  pushsrc_class->create = GST_DEBUG_FUNCPTR (gst_tensor_src_file_create);
+
+  gst_element_class_set_static_metadata (element_class,
+      "TensorSrcFile",
+      "Source/Tensor/File",
+      "Replay the tensor frames in a file without copying the data",
+      "Samsung Electronics Co., Ltd.");
+
+  gst_element_class_add_static_pad_template (element_class, &src_template);
+}
+
+/**
+ * @brief object initialization of tensor_src_file
+ */
+static void
+gst_tensor_src_file_init (GstTensorSrcFile * self)
+{
+  self->location = NULL;
+  self->caps = NULL;
+  self->loop = DEFAULT_LOOP;
+  self->silent = DEFAULT_SILENT;
+
+  self->file = NULL;
+  self->src_caps = NULL;
+  gst_tensors_config_init (&self->config);
+  self->data_offset = 0;
+  self->frame_size = 0;
+  self->num_frames = 0;
+  self->frame_index = 0;
+  self->frame_count = 0;
+
+  gst_base_src_set_format (GST_BASE_SRC (self), GST_FORMAT_TIME);
+}
+
+/**
+ * @brief object finalize of tensor_src_file
+ */
+static void
+gst_tensor_src_file_finalize (GObject * object)
+{
+  GstTensorSrcFile *self = GST_TENSOR_SRC_FILE (object);
+
+  g_free (self->location);
+
+  if (self->caps)
+    gst_caps_unref (self->caps);
+
+  if (self->src_caps)
+    gst_caps_unref (self->src_caps);
+
+  if (self->file)
+    g_mapped_file_unref (self->file);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+/**
+ * @brief set property of tensor_src_file
+ */
+static void
+gst_tensor_src_file_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstTensorSrcFile *self = GST_TENSOR_SRC_FILE (object);
+
+  switch (prop_id) {
+    case PROP_LOCATION:
+      g_free (self->location);
+      self->location = g_value_dup_string (value);
+      break;
+    case PROP_CAPS:
+    {
+      const GstCaps *caps = gst_value_get_caps (value);
+      GstCaps *new_caps = NULL;
+
+      if (caps)
+        new_caps = gst_caps_copy (caps);
+
+      gst_caps_replace (&self->caps, new_caps);
+
+      if (new_caps)
+        gst_caps_unref (new_caps);
+      break;
+    }
+    case PROP_LOOP:
+      self->loop = g_value_get_boolean (value);
+      break;
+    case PROP_SILENT:
+      self->silent = g_value_get_boolean (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+/**
+ * @brief get property of tensor_src_file
+ */
+static void
+gst_tensor_src_file_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstTensorSrcFile *self = GST_TENSOR_SRC_FILE (object);
+
+  switch (prop_id) {
+    case PROP_LOCATION:
+      g_value_set_string (value, self->location);
+      break;
+    case PROP_CAPS:
+      gst_value_set_caps (value, self->caps);
+      break;
+    case PROP_LOOP:
+      g_value_set_boolean (value, self->loop);
+      break;
+    case PROP_SILENT:
+      g_value_set_boolean (value, self->silent);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+/**
+ * @brief Check the tensor file has the header.
+ */
+static gboolean
+gst_tensor_src_file_has_header (const gchar * data, gsize len)
+{
+  return (len >= TENSOR_FILE_HEADER_MIN &&
+      memcmp (data, TENSOR_FILE_MAGIC, 8) == 0);
+}
+
+/**
+ * @brief Parse the header of tensor file.
+ * @param self "this" pointer
+ * @param data the data of mapped file
+ * @param len the size of mapped file
+ * @param[out] caps the caps string in the header (newly allocated)
+ * @return TRUE if the header is valid
+ */
+static gboolean
+gst_tensor_src_file_parse_header (GstTensorSrcFile * self,
+    const gchar * data, gsize len, gchar ** caps)
+{
+  guint32 version, header_size;
+  gsize max_len;
+
+  *caps = NULL;
+
+  memcpy (&version, data + 8, sizeof (guint32));
+  memcpy (&header_size, data + 12, sizeof (guint32));
+  version = GUINT32_FROM_LE (version);
+  header_size = GUINT32_FROM_LE (header_size);
+
+  if (version != TENSOR_FILE_VERSION) {
+    GST_ERROR_OBJECT (self, "Unsupported version %u of the tensor file %s.",
+        version, self->location);
+    return FALSE;
+  }
+
+  if (header_size <= TENSOR_FILE_HEADER_MIN || header_size > len) {
+    GST_ERROR_OBJECT (self, "Invalid header size %u of the tensor file %s.",
+        header_size, self->location);
+    return FALSE;
+  }
+
+  /* caps string should be null-terminated in the header */
+  max_len = header_size - TENSOR_FILE_HEADER_MIN;
+  if (memchr (data + TENSOR_FILE_HEADER_MIN, '\0', max_len) == NULL) {
+    GST_ERROR_OBJECT (self, "Invalid caps string in the tensor file %s.",
+        self->location);
+    return FALSE;
+  }
+
+  *caps = g_strdup (data + TENSOR_FILE_HEADER_MIN);
+  self->data_offset = header_size;
+  return TRUE;
+}
+
+/**
+ * @brief Set the tensors config and the caps of src pad from the caps.
+ * @param self "this" pointer
+ * @param caps the caps describing the tensors in the file
+ * @return TRUE if the caps is valid
+ */
+static gboolean
+gst_tensor_src_file_configure (GstTensorSrcFile * self, GstCaps * caps)
+{
+  GstStructure *structure;
+  GstTensorsConfig config;
+  gboolean is_tensor;
+  guint i;
+
+  if (!caps || gst_caps_get_size (caps) != 1 || !gst_caps_is_fixed (caps)) {
+    GST_ERROR_OBJECT (self, "The caps should be fixed, given %" GST_PTR_FORMAT,
+        caps);
+    return FALSE;
+  }
+
+  structure = gst_caps_get_structure (caps, 0);
+  if (!gst_tensors_config_from_structure (&config, structure)) {
+    GST_ERROR_OBJECT (self, "Failed to get the config from %" GST_PTR_FORMAT,
+        caps);
+    return FALSE;
+  }
+
+  /* push the frames as fast as possible if framerate is not given */
+  if (!gst_structure_has_field (structure, "framerate")) {
+    config.rate_n = 0;
+    config.rate_d = 1;
+  }
+
+  if (!gst_tensors_config_validate (&config)) {
+    GST_ERROR_OBJECT (self, "Invalid config from %" GST_PTR_FORMAT, caps);
+    return FALSE;
+  }
+
+  self->frame_size = 0;
+  for (i = 0; i < config.info.num_tensors; i++)
+    self->frame_size += gst_tensor_info_get_size (&config.info.info[i]);
+
+  is_tensor = gst_structure_has_name (structure, "other/tensor");
+  if (self->src_caps)
+    gst_caps_unref (self->src_caps);
+
+  if (is_tensor) {
+    GstTensorConfig c;
+
+    c.info = config.info.info[0];
+    c.rate_n = config.rate_n;
+    c.rate_d = config.rate_d;
+    self->src_caps = gst_tensor_caps_from_config (&c);
+  } else {
+    self->src_caps = gst_tensors_caps_from_config (&config);
+  }
+
+  self->config = config;
+  return TRUE;
+}
+
+/**
+ * @brief Start tensor_src_file, map the tensor file and parse the header.
+ */
+static gboolean
+gst_tensor_src_file_start (GstBaseSrc * src)
+{
+  GstTensorSrcFile *self = GST_TENSOR_SRC_FILE (src);
+  GError *error = NULL;
+  GstCaps *caps = NULL;
+  gchar *caps_str = NULL;
+  const gchar *data;
+  gsize len;
+  gboolean ret = FALSE;
+
+  if (!self->location || self->location[0] == '\0') {
+    GST_ELEMENT_ERROR (self, RESOURCE, NOT_FOUND,
+        ("No file name specified for reading."), (NULL));
+    return FALSE;
+  }
+
+  self->file = g_mapped_file_new (self->location, FALSE, &error);
+  if (!self->file) {
+    GST_ELEMENT_ERROR (self, RESOURCE, OPEN_READ,
+        ("Could not open file \"%s\" for reading.", self->location),
+        ("%s", error ? error->message : "unknown error"));
+    g_clear_error (&error);
+    return FALSE;
+  }
+
+  data = g_mapped_file_get_contents (self->file);
+  len = g_mapped_file_get_length (self->file);
+  self->data_offset = 0;
+
+  if (gst_tensor_src_file_has_header (data, len) &&
+      !gst_tensor_src_file_parse_header (self, data, len, &caps_str)) {
+    GST_ELEMENT_ERROR (self, STREAM, WRONG_TYPE,
+        ("Invalid header in the tensor file \"%s\".", self->location), (NULL));
+    goto done;
+  }
+
+  if (self->caps) {
+    caps = gst_caps_ref (self->caps);
+  } else if (caps_str) {
+    caps = gst_caps_from_string (caps_str);
+  } else {
+    GST_ELEMENT_ERROR (self, CORE, NEGOTIATION,
+        ("The caps is required to read the raw tensor file \"%s\".",
+            self->location), (NULL));
+    goto done;
+  }
+
+  if (!gst_tensor_src_file_configure (self, caps)) {
+    GST_ELEMENT_ERROR (self, CORE, NEGOTIATION,
+        ("Invalid caps of the tensor file \"%s\".", self->location), (NULL));
+    goto done;
+  }
+
+  self->num_frames = (len - self->data_offset) / self->frame_size;
+  if (self->num_frames == 0) {
+    GST_ELEMENT_ERROR (self, STREAM, WRONG_TYPE,
+        ("No frame in the tensor file \"%s\" (frame size %" G_GSIZE_FORMAT ").",
+            self->location, self->frame_size), (NULL));
+    goto done;
+  }
+
+  if ((len - self->data_offset) % self->frame_size) {
+    GST_WARNING_OBJECT (self,
+        "The size of file is not aligned to the frame, the remainder is ignored.");
+  }
+
+  self->frame_index = 0;
+  self->frame_count = 0;
+
+  if (!self->silent) {
+    GST_INFO_OBJECT (self, "%" G_GUINT64_FORMAT " frames in %s, caps %"
+        GST_PTR_FORMAT, self->num_frames, self->location, self->src_caps);
+  }
+
+  ret = TRUE;
+
+done:
+  if (caps)
+    gst_caps_unref (caps);
+  g_free (caps_str);
+
+  if (!ret) {
+    g_mapped_file_unref (self->file);
+    self->file = NULL;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Stop tensor_src_file, release the mapped file.
+ * @note The memory pushed downstream holds its own reference of the mapped file.
+ */
+static gboolean
+gst_tensor_src_file_stop (GstBaseSrc * src)
+{
+  GstTensorSrcFile *self = GST_TENSOR_SRC_FILE (src);
+
+  if (self->file) {
+    g_mapped_file_unref (self->file);
+    self->file = NULL;
+  }
+
+  if (self->src_caps) {
+    gst_caps_unref (self->src_caps);
+    self->src_caps = NULL;
+  }
+
+  gst_tensors_config_init (&self->config);
+  self->num_frames = 0;
+  return TRUE;
+}
+
+/**
+ * @brief get caps of tensor_src_file
+ */
+static GstCaps *
+gst_tensor_src_file_get_caps (GstBaseSrc * src, GstCaps * filter)
+{
+  GstTensorSrcFile *self = GST_TENSOR_SRC_FILE (src);
+  GstCaps *caps;
+
+  if (self->src_caps) {
+    caps = gst_caps_ref (self->src_caps);
+  } else {
+    caps = gst_pad_get_pad_template_caps (GST_BASE_SRC_PAD (src));
+  }
+
+  if (filter) {
+    GstCaps *intersection;
+
+    intersection =
+        gst_caps_intersect_full (filter, caps, GST_CAPS_INTERSECT_FIRST);
+    gst_caps_unref (caps);
+    caps = intersection;
+  }
+
+  GST_DEBUG_OBJECT (self, "returning %" GST_PTR_FORMAT, caps);
+  return caps;
+}
+
+/**
+ * @brief tensor_src_file does not support seeking (frames are pushed in order).
+ */
+static gboolean
+gst_tensor_src_file_is_seekable (GstBaseSrc * src)
+{
+  return FALSE;
+}
+
+/**
+ * @brief create func of tensor_src_file, wrap the frame in the mapped file.
+ */
+static GstFlowReturn
+gst_tensor_src_file_create (GstPushSrc * src, GstBuffer ** buffer)
+{
+  GstTensorSrcFile *self = GST_TENSOR_SRC_FILE (src);
+  GstBuffer *buf;
+  GstMemory *mem;
+  gchar *contents;
+  gsize len, offset, size;
+  guint i;
+
+  if (!self->file)
+    return GST_FLOW_FLUSHING;
+
+  if (self->frame_index >= self->num_frames) {
+    if (!self->loop)
+      return GST_FLOW_EOS;
+
+    self->frame_index = 0;
+  }
+
+  contents = g_mapped_file_get_contents (self->file);
+  len = g_mapped_file_get_length (self->file);
+  offset = self->data_offset + self->frame_index * self->frame_size;
+
+  buf = gst_buffer_new ();
+
+  for (i = 0; i < self->config.info.num_tensors; i++) {
+    size = gst_tensor_info_get_size (&self->config.info.info[i]);
+
+    /* each memory holds the mapped file, the file is unmapped when all buffers are released */
+    mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, contents, len,
+        offset, size, g_mapped_file_ref (self->file),
+        (GDestroyNotify) g_mapped_file_unref);
+    gst_buffer_append_memory (buf, mem);
+
+    offset += size;
+  }
+
+  if (self->config.rate_n > 0) {
+    GstClockTime ts, next;
+
+    ts = gst_util_uint64_scale (self->frame_count,
+        GST_SECOND * self->config.rate_d, self->config.rate_n);
+    next = gst_util_uint64_scale (self->frame_count + 1,
+        GST_SECOND * self->config.rate_d, self->config.rate_n);
+
+    GST_BUFFER_PTS (buf) = ts;
+    GST_BUFFER_DURATION (buf) = next - ts;
+  }
+
+  GST_BUFFER_OFFSET (buf) = self->frame_index;
+  GST_BUFFER_OFFSET_END (buf) = self->frame_index + 1;
+
+  self->frame_index++;
+  self->frame_count++;
+
+  *buffer = buf;
+  return GST_FLOW_OK;
+}
@@ -0,0 +1,105 @@
+/**
+ * GStreamer / NNStreamer tensor_src_file
+ * Copyright (C) 2019 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ */
+
+/**
+ * @file	tensor_src_file.h
+ * @date	18 Oct 2019
+ * @brief	GStreamer plugin to replay the tensor frames in a file (memory-mapped)
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @bug		No known bugs except for NYI items
+ */
+
+#ifndef __GST_TENSOR_SRC_FILE_H__
+#define __GST_TENSOR_SRC_FILE_H__
+
+#include <gst/gst.h>
+#include <gst/base/gstpushsrc.h>
+#include <tensor_common.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_TENSOR_SRC_FILE \
+  (gst_tensor_src_file_get_type())
+#define GST_TENSOR_SRC_FILE(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_TENSOR_SRC_FILE,GstTensorSrcFile))
+#define GST_TENSOR_SRC_FILE_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_TENSOR_SRC_FILE,GstTensorSrcFileClass))
+#define GST_IS_TENSOR_SRC_FILE(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_TENSOR_SRC_FILE))
+#define GST_IS_TENSOR_SRC_FILE_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_TENSOR_SRC_FILE))
+
+/**
+ * @brief The magic of tensor file with the header.
+ *
+ * The tensor file with the header (little endian):
+ * - magic (8 bytes, "NNSTDUMP")
+ * - version (uint32, TENSOR_FILE_VERSION)
+ * - header size (uint32, the offset of the first frame)
+ * - caps string (null-terminated, padded to the header size)
+ * - frames (the data of the tensors in a frame are contiguous)
+ */
+#define TENSOR_FILE_MAGIC "NNSTDUMP"
+
+/**
+ * @brief The version of tensor file with the header.
+ */
+#define TENSOR_FILE_VERSION (1U)
+
+typedef struct _GstTensorSrcFile GstTensorSrcFile;
+typedef struct _GstTensorSrcFileClass GstTensorSrcFileClass;
+
+/**
+ * @brief GstTensorSrcFile data structure.
+ *
+ * GstTensorSrcFile inherits GstPushSrc
+ */
+struct _GstTensorSrcFile
+{
+  GstPushSrc parent; /**< parent object */
+
+  gchar *location; /**< path of the tensor file */
+  GstCaps *caps; /**< caps of the tensors (required for raw file without the header) */
+  gboolean loop; /**< true to repeat the frames in the file */
+  gboolean silent; /**< true to print minimized log */
+
+  GMappedFile *file; /**< memory-mapped tensor file */
+  GstCaps *src_caps; /**< caps of the frames to be pushed */
+  GstTensorsConfig config; /**< tensors config of the frames */
+  gsize data_offset; /**< offset of the first frame */
+  gsize frame_size; /**< size of a frame */
+  guint64 num_frames; /**< the number of frames in the file */
+  guint64 frame_index; /**< index of next frame in the file */
+  guint64 frame_count; /**< the number of pushed frames */
+};
+
+/**
+ * @brief GstTensorSrcFileClass data structure.
+ *
+ * GstTensorSrcFile inherits GstPushSrc
+ */
+struct _GstTensorSrcFileClass
+{
+  GstPushSrcClass parent_class; /**< parent class */
+};
+
+/**
+ * @brief Function to get type of tensor_src_file.
+ */
+GType gst_tensor_src_file_get_type (void);
+
+G_END_DECLS
+
+#endif /* __GST_TENSOR_SRC_FILE_H__ */
@@ -400,7 +400,10 @@ done:
  * @param split TensorSplit Object
  * @param buffer gstbuffer form src
  * @param nth orther of tensor
- * @return return GstMemory for splited tensor
+ * @return return GstMemory for splited tensor, NULL if the segment is out of the buffer.
+ * @note Each segment is a contiguous range of the incoming tensor (split along the outermost dimension).
+ * The segment shares the memory of incoming buffer, the data is copied only if the buffer has multiple memories
+ * or the memory cannot be shared (GST_MEMORY_FLAG_NO_SHARE).
  */
 static GstMemory *
 gst_tensor_split_get_splited (GstTensorSplit * split, GstBuffer * buffer,
@@ -409,26 +412,43 @@ gst_tensor_split_get_splited (GstTensorSplit * split, GstBuffer * buffer,
   GstMemory *mem;
   tensor_dim *dim;
   int i;
-  size_t size, offset;
-  GstMapInfo src_info, dest_info;
+  gsize size, offset, element_size;
+  GstMapInfo dest_info;
 
-  size = 0;
-  offset = 0;
-  dim = g_array_index (split->tensorseg, tensor_dim *, nth);
-
-  size += gst_tensor_get_element_count (*dim) *
+  element_size =
       gst_tensor_get_element_size (split->sink_tensor_conf.info.type);
-  mem = gst_allocator_alloc (NULL, size, NULL);
-  g_assert (gst_memory_map (mem, &dest_info, GST_MAP_WRITE));
-  g_assert (gst_buffer_map (buffer, &src_info, GST_MAP_READ));
+  offset = 0;
 
   for (i = 0; i < nth; i++) {
     dim = g_array_index (split->tensorseg, tensor_dim *, i);
-    offset += gst_tensor_get_element_count (*dim);
+    offset += gst_tensor_get_element_count (*dim) * element_size;
+  }
+
+  dim = g_array_index (split->tensorseg, tensor_dim *, nth);
+  size = gst_tensor_get_element_count (*dim) * element_size;
+
+  if (offset + size > gst_buffer_get_size (buffer)) {
+    GST_ERROR_OBJECT (split, "The %d-th segment (offset %zd, size %zd) "
+        "is out of the incoming buffer (size %zd).", nth, offset, size,
+        gst_buffer_get_size (buffer));
+    return NULL;
+  }
+
+  if (gst_buffer_n_memory (buffer) == 1) {
+    GstMemory *in_mem = gst_buffer_peek_memory (buffer, 0);
+
+    /* the memory which cannot be shared is copied below */
+    if (!GST_MEMORY_FLAG_IS_SET (in_mem, GST_MEMORY_FLAG_NO_SHARE)) {
+      mem = gst_memory_share (in_mem, offset, size);
+      if (mem)
+        return mem;
+    }
   }
 
-  nns_memcpy (dest_info.data, src_info.data + offset, size);
-  gst_buffer_unmap (buffer, &src_info);
+  mem = gst_allocator_alloc (NULL, size, NULL);
+  g_assert (gst_memory_map (mem, &dest_info, GST_MAP_WRITE));
+
+  gst_buffer_extract (buffer, offset, dest_info.data, size);
   gst_memory_unmap (mem, &dest_info);
 
   return mem;
@@ -451,6 +471,7 @@ gst_tensor_split_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
   if (split->tensorseg == NULL) {
     GST_ERROR_OBJECT (split, "No rule to split incoming buffers.");
+    gst_buffer_unref (buf);
     return GST_FLOW_ERROR;
   }
 
@@ -476,8 +497,13 @@ gst_tensor_split_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
     srcpad = gst_tensor_split_get_tensor_pad (split, buf, &created, i);
 
-    outbuf = gst_buffer_new ();
     mem = gst_tensor_split_get_splited (split, buf, i);
+    if (mem == NULL) {
+      res = GST_FLOW_ERROR;
+      break;
+    }
+
+    outbuf = gst_buffer_new ();
     gst_buffer_append_memory (outbuf, mem);
     ts = GST_BUFFER_TIMESTAMP (buf);
 
@@ -507,6 +533,7 @@ gst_tensor_split_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       break;
   }
 
+  gst_buffer_unref (buf);
   return res;
 }
 
@@ -24,6 +24,7 @@
 typedef struct _pt_data
 {
   uint32_t id; /***< Just for testing */
+  int batch_only; /***< Fail invoke for a single frame to test invoke_batch (custom property "batch-only") */
 } pt_data;
 
 /**
@@ -36,6 +37,8 @@ pt_init (const GstTensorFilterProperties * prop)
   assert (data);
 
   data->id = 0;
+  data->batch_only = (prop->custom_properties &&
+      strcmp (prop->custom_properties, "batch-only") == 0);
   return data;
 }
 
@@ -90,6 +93,9 @@ pt_invoke (void *private_data, const GstTensorFilterProperties * prop,
   assert (input);
   assert (output);
 
+  if (data->batch_only)
+    return -1;
+
   for (t = 0; t < prop->output_meta.num_tensors; t++) {
     size = gst_tensor_info_get_size (&prop->output_meta.info[t]);
 
@@ -100,6 +106,40 @@ pt_invoke (void *private_data, const GstTensorFilterProperties * prop,
   return 0;
 }
 
+/**
+ * @brief pt_invoke_batch
+ */
+static int
+pt_invoke_batch (void *private_data, const GstTensorFilterProperties * prop,
+    const GstTensorMemory * input, GstTensorMemory * output,
+    unsigned int num_frames)
+{
+  pt_data *data = private_data;
+  unsigned int k;
+  int t, num_in, num_out;
+
+  assert (data);
+  assert (input);
+  assert (output);
+
+  num_in = prop->input_meta.num_tensors;
+  num_out = prop->output_meta.num_tensors;
+  assert (num_in == num_out);
+
+  for (k = 0; k < num_frames; k++) {
+    for (t = 0; t < num_out; t++) {
+      const GstTensorMemory *in = &input[k * num_in + t];
+      GstTensorMemory *out = &output[k * num_out + t];
+
+      assert (in->data != out->data);
+      assert (in->size == out->size);
+      memcpy (out->data, in->data, out->size);
+    }
+  }
+
+  return 0;
+}
+
 static NNStreamer_custom_class NNStreamer_custom_body = {
   .initfunc = pt_init,
   .exitfunc = pt_exit,
@@ -109,3 +149,10 @@ static NNStreamer_custom_class NNStreamer_custom_body = {
 
 /* The dyn-loaded object */
 NNStreamer_custom_class *NNStreamer_custom = &NNStreamer_custom_body;
+
+static NNStreamer_custom_class_ext NNStreamer_custom_ext_body = {
+  .invoke_batch = pt_invoke_batch,
+};
+
+/* The extended capabilities */
+NNStreamer_custom_class_ext *NNStreamer_custom_ext = &NNStreamer_custom_ext_body;
@@ -249,6 +249,7 @@ ninja -C build %{?_smp_mflags}
     ./tests/unittest_sink --gst-plugin-path=. --gtest_output="xml:unittest_sink.xml"
     ./tests/unittest_plugins --gst-plugin-path=. --gtest_output="xml:unittest_plugins.xml"
     ./tests/unittest_src_iio --gst-plugin-path=. --gtest_output="xml:unittest_src_iio.xml"
+    ./tests/unittest_src_file --gst-plugin-path=. --gtest_output="xml:unittest_src_file.xml"
     ./tests/tizen_capi/unittest_tizen_capi --gst-plugin-path=. --gtest_output="xml:unittest_tizen_capi.xml"
     ./tests/tizen_capi/unittest_tizen_capi_single_new --gst-plugin-path=. --gtest_output="xml:unittest_tizen_capi_single_new.xml"
     popd
@@ -325,6 +326,7 @@ cp -r result %{buildroot}%{_datadir}/nnstreamer/unittest/
 %defattr(-,root,root,-)
 %license LICENSE
 %{_prefix}/lib/nnstreamer/decoders/libnnstreamer_decoder_*.so
+%{_prefix}/lib/nnstreamer/customfilters/libnnstreamer_customfilter_resize.so
 %{gstlibdir}/*.so
 %{_libdir}/libnnstreamer.so
 %{_sysconfdir}/nnstreamer.ini
@@ -376,6 +378,7 @@ cp -r result %{buildroot}%{_datadir}/nnstreamer/unittest/
 %defattr(-,root,root,-)
 %license LICENSE
 %{_prefix}/lib/nnstreamer/customfilters/*.so
+%exclude %{_prefix}/lib/nnstreamer/customfilters/libnnstreamer_customfilter_resize.so
 
 %if %{with tizen}
 %files -n capi-nnstreamer
@@ -588,6 +588,58 @@ TEST (common_string_util, replace_str_02)
   g_free (result);
 }
 
+/**
+ * @brief Test to copy a tensor with several memory blocks into a contiguous buffer.
+ */
+TEST (common_tensor_buffer, get_contiguous)
+{
+  GstBufferPool *pool = NULL;
+  GstBuffer *buffer, *contiguous;
+  GstMemory *last;
+  GstMapInfo map;
+  guint8 data[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  guint i;
+
+  gst_init (NULL, NULL);
+
+  buffer = gst_buffer_new ();
+  gst_buffer_append_memory (buffer,
+      gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, data, 8, 0, 4, NULL, NULL));
+  gst_buffer_append_memory (buffer,
+      gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, data, 8, 4, 4, NULL, NULL));
+
+  contiguous = gst_tensor_buffer_get_contiguous (&pool, buffer);
+  ASSERT_TRUE (contiguous != NULL);
+  ASSERT_TRUE (pool != NULL);
+  EXPECT_EQ (gst_buffer_n_memory (contiguous), 1U);
+
+  ASSERT_TRUE (gst_buffer_map (contiguous, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 8U);
+  for (i = 0; i < 8; i++)
+    EXPECT_EQ (map.data[i], data[i]);
+  gst_buffer_unmap (contiguous, &map);
+
+  /* the buffer returns to the pool, the next one reuses its memory */
+  last = gst_buffer_peek_memory (contiguous, 0);
+  gst_buffer_unref (contiguous);
+
+  contiguous = gst_tensor_buffer_get_contiguous (&pool, buffer);
+  ASSERT_TRUE (contiguous != NULL);
+  EXPECT_TRUE (gst_buffer_peek_memory (contiguous, 0) == last);
+  gst_buffer_unref (contiguous);
+
+  /* the size is changed, the pool is created again */
+  gst_buffer_remove_memory (buffer, 1);
+  contiguous = gst_tensor_buffer_get_contiguous (&pool, buffer);
+  ASSERT_TRUE (contiguous != NULL);
+  EXPECT_EQ (gst_buffer_get_size (contiguous), 4U);
+  gst_buffer_unref (contiguous);
+
+  gst_buffer_unref (buffer);
+  gst_buffer_pool_set_active (pool, FALSE);
+  gst_object_unref (pool);
+}
+
 /**
  * @brief Create null files
  */
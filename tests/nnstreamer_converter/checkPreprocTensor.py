@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+
+##
+# Copyright (C) 2019 Samsung Electronics
+# License: LGPL-2.1
+#
+# @file checkPreprocTensor.py
+# @brief Check if the tensors resized and normalized in tensor_converter are correct
+#
+# The raw video frames (the rows are aligned to 4 bytes) are resized with
+# bilinear interpolation (half-pixel centers), normalized with float and
+# compared with the tensors (uint8 may differ by 1 for rounding).
+
+import sys
+import math
+import struct
+
+
+def coefficient (insize, outsize, i):
+  pos = max((i + 0.5) * float(insize) / outsize - 0.5, 0.0)
+  p0 = int(math.floor(pos))
+  if p0 >= insize - 1:
+    return (insize - 1, insize - 1, 0.0)
+  return (p0, p0 + 1, pos - p0)
+
+
+def get_values (string, channel):
+  values = [float(v) for v in string.split(':')]
+  if len(values) == 1:
+    values = values * channel
+  return values
+
+
+def compare (frame, channel, width1, height1, tensor, width2, height2, ttype, mean, scale):
+  stride = ((width1 * channel + 3) // 4) * 4
+
+  if ttype == 'float32':
+    if len(tensor) != width2 * height2 * channel * 4:
+      print(str(len(tensor)) + " / " + str(width2 * height2 * channel * 4))
+      return 1
+    tensor = struct.unpack(str(len(tensor) // 4) + 'f', tensor)
+  elif len(tensor) != width2 * height2 * channel:
+    print(str(len(tensor)) + " / " + str(width2 * height2 * channel))
+    return 1
+
+  for y in range(0, height2):
+    (y0, y1, wy) = coefficient(height1, height2, y)
+    for x in range(0, width2):
+      (x0, x1, wx) = coefficient(width1, width2, x)
+      for c in range(0, channel):
+        p00 = frame[y0 * stride + x0 * channel + c]
+        p01 = frame[y0 * stride + x1 * channel + c]
+        p10 = frame[y1 * stride + x0 * channel + c]
+        p11 = frame[y1 * stride + x1 * channel + c]
+        top = p00 + (p01 - p00) * wx
+        bottom = p10 + (p11 - p10) * wx
+        value = (top + (bottom - top) * wy - mean[c]) * scale[c]
+        result = tensor[(y * width2 + x) * channel + c]
+
+        if ttype == 'float32':
+          if abs(result - value) > 1e-3 * max(1.0, abs(value)):
+            print("At " + str(x) + "," + str(y))
+            return 5
+        else:
+          expected = min(max(int(math.floor(value + 0.5)), 0), 255)
+          if abs(result - expected) > 1:
+            print("At " + str(x) + "," + str(y))
+            return 5
+
+  return 0
+
+def readfile (filename):
+  F = open(filename, 'rb')
+  readfile = bytearray(F.read())
+  F.close()
+  return readfile
+
+
+if len(sys.argv) != 11:
+  exit(9)
+
+frame = readfile(sys.argv[1])
+channel = int(sys.argv[2])
+width1 = int(sys.argv[3])
+height1 = int(sys.argv[4])
+tensor = readfile(sys.argv[5])
+width2 = int(sys.argv[6])
+height2 = int(sys.argv[7])
+ttype = sys.argv[8]
+mean = get_values(sys.argv[9], channel)
+scale = get_values(sys.argv[10], channel)
+
+exit(compare(frame, channel, width1, height1, tensor, width2, height2, ttype, mean, scale))
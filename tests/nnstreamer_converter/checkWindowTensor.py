@@ -0,0 +1,47 @@
+#!/usr/bin/env python
+
+##
+# Copyright (C) 2019 Samsung Electronics
+# License: LGPL-2.1
+#
+# @file checkWindowTensor.py
+# @brief Check if the overlapping windows (frames-hop) of tensor_converter are correct
+#
+# The tensors are the windows of the raw stream, moved with the hop.
+
+import sys
+
+
+def compare (stream, tensors, window, hop):
+  if len(stream) < window:
+    print("The stream is shorter than a window.")
+    return 1
+
+  count = (len(stream) - window) // hop + 1
+  if len(tensors) != count * window:
+    print(str(len(tensors)) + " / " + str(count * window))
+    return 1
+
+  for i in range(0, count):
+    if tensors[i * window:(i + 1) * window] != stream[i * hop:i * hop + window]:
+      print("At window " + str(i))
+      return 5
+
+  return 0
+
+def readfile (filename):
+  F = open(filename, 'rb')
+  readfile = bytearray(F.read())
+  F.close()
+  return readfile
+
+
+if len(sys.argv) != 5:
+  exit(9)
+
+stream = readfile(sys.argv[1])
+tensors = readfile(sys.argv[2])
+window = int(sys.argv[3])
+hop = int(sys.argv[4])
+
+exit(compare(stream, tensors, window, hop))
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+
+##
+# Copyright (C) 2019 Samsung Electronics
+# License: LGPL-2.1
+#
+# @file checkYUVTensor.py
+# @brief Check if the RGB tensors converted from YUV video are correct
+#
+# The raw YUV frames (BT.601, limited range) are converted to RGB with float
+# and compared with the tensors. Each element may differ by 1 for rounding.
+
+import sys
+import math
+
+
+def clamp (value):
+  return min(max(int(math.floor(value + 0.5)), 0), 255)
+
+
+def yuv_at (data, fmt, width, height, x, y):
+  if fmt == 'I420':
+    ysize = width * height
+    cw = (width + 1) // 2
+    ch = (height + 1) // 2
+    Y = data[y * width + x]
+    U = data[ysize + (y // 2) * cw + (x // 2)]
+    V = data[ysize + cw * ch + (y // 2) * cw + (x // 2)]
+  elif fmt == 'NV12':
+    ysize = width * height
+    cw = ((width + 1) // 2) * 2
+    Y = data[y * width + x]
+    U = data[ysize + (y // 2) * cw + (x // 2) * 2]
+    V = data[ysize + (y // 2) * cw + (x // 2) * 2 + 1]
+  else:
+    # YUY2
+    stride = ((width + 1) // 2) * 4
+    Y = data[y * stride + x * 2]
+    U = data[y * stride + (x // 2) * 4 + 1]
+    V = data[y * stride + (x // 2) * 4 + 3]
+  return (Y, U, V)
+
+
+def compare (yuv, fmt, width, height, tensor, order):
+  if len(tensor) != width * height * 3:
+    print(str(len(tensor)) + " / " + str(width * height * 3))
+    return 1
+
+  kr = 0.299
+  kb = 0.114
+  kg = 1.0 - kr - kb
+
+  for y in range(0, height):
+    for x in range(0, width):
+      (Y, U, V) = yuv_at(yuv, fmt, width, height, x, y)
+      Y = (Y - 16) * 255.0 / 219.0
+      U = (U - 128) * 255.0 / 224.0
+      V = (V - 128) * 255.0 / 224.0
+
+      rgb = [clamp(Y + 2.0 * (1.0 - kr) * V),
+          clamp(Y - 2.0 * kb * (1.0 - kb) / kg * U - 2.0 * kr * (1.0 - kr) / kg * V),
+          clamp(Y + 2.0 * (1.0 - kb) * U)]
+      if order == 'BGR':
+        rgb.reverse()
+
+      idx = (y * width + x) * 3
+      for c in range(0, 3):
+        if abs(tensor[idx + c] - rgb[c]) > 1:
+          print("At " + str(x) + "," + str(y))
+          return 5
+
+  return 0
+
+def readfile (filename):
+  F = open(filename, 'rb')
+  readfile = bytearray(F.read())
+  F.close()
+  return readfile
+
+
+if len(sys.argv) != 7:
+  exit(9)
+
+yuv = readfile(sys.argv[1])
+fmt = sys.argv[2]
+width = int(sys.argv[3])
+height = int(sys.argv[4])
+tensor = readfile(sys.argv[5])
+order = sys.argv[6]
+
+exit(compare(yuv, fmt, width, height, tensor, order))
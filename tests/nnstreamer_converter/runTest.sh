@@ -58,8 +58,7 @@ do_test BGRx 642 480 2-4
 do_test RGB 642 480 2-5
 do_test GRAY8 642 480 2-6
 
-# @TODO Change this when YUV becomes supported by tensor_converter
-# Fail Test: YUV is given
+# Fail Test: Invalid video format (YUV) is given
 gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=YUV,width=280,height=40,framerate=0/1 ! videoconvert ! video/x-raw, format=YUV ! tensor_converter silent=TRUE ! filesink location=\"test.yuv.fail.log\" sync=true" 5F_n 0 1 $PERFORMANCE
 
 # Fail Test: Unknown property is given
@@ -80,6 +79,71 @@ callCompareTest test.audio16k2c.u16le.origin.log test.audio16k2c.u16le.log 7-6 "
 # audio format S32LE, 8k sample rate, samples per buffer 8000
 gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} audiotestsrc num-buffers=1 samplesperbuffer=8000 ! audioconvert ! audio/x-raw,format=S32LE,rate=8000 ! tensor_converter frames-per-tensor=8000 ! filesink location=\"test.audio8k.s32le.log\" sync=true" 7-7 0 0 $PERFORMANCE
 
+# audio format S16LE, 16k sample rate, overlapping windows (100 ms window with 25 ms hop)
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} audiotestsrc num-buffers=10 samplesperbuffer=1600 ! audioconvert ! audio/x-raw,format=S16LE,rate=16000 ! tee name=t ! queue ! audioconvert ! tensor_converter frames-per-tensor=1600 frames-hop=400 ! filesink location=\"test.audio16k.hop.log\" sync=true t. ! queue ! filesink location=\"test.audio16k.hop.origin.log\" sync=true" 7-8 0 0 $PERFORMANCE
+python checkWindowTensor.py test.audio16k.hop.origin.log test.audio16k.hop.log 3200 800
+testResult $? 7-9 "Audio16k-s16le frames-hop Test" 0 1
+
+# Fail Test: frames-hop is larger than frames-per-tensor
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} audiotestsrc num-buffers=1 samplesperbuffer=1600 ! audioconvert ! audio/x-raw,format=S16LE,rate=16000 ! tensor_converter frames-per-tensor=400 frames-hop=1600 ! filesink location=\"test.audio16k.hop.fail.log\" sync=true" 7F_n 0 1 $PERFORMANCE
+
+##
+## @brief Execute gstreamer pipeline and compare the RGB tensor with YUV frame.
+## @param $1 YUV format
+## @param $2 Color format of output tensor
+## @param $3 Test Case Number
+function do_test_yuv() {
+    gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=${1},width=280,height=40,framerate=0/1 ! tee name=t ! queue ! tensor_converter output-format=${2} ! filesink location=\"test.yuv.${1}.${2}.log\" sync=true t. ! queue ! filesink location=\"test.yuv.${1}.${2}.origin.log\" sync=true" ${3}-1 0 0 $PERFORMANCE
+
+    python checkYUVTensor.py test.yuv.${1}.${2}.origin.log ${1} 280 40 test.yuv.${1}.${2}.log ${2}
+    testResult $? ${3}-2 "YUV ${1} to ${2} Test" 0 1
+}
+
+do_test_yuv I420 RGB 9-1
+do_test_yuv NV12 RGB 9-2
+do_test_yuv YUY2 RGB 9-3
+do_test_yuv I420 BGR 9-4
+
+# Video frame with the strides and offset in video meta (cropped frame)
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=648,height=480,framerate=0/1 ! tee name=t ! queue ! videocrop left=4 right=4 ! tensor_converter ! filesink location=\"test.crop.log\" sync=true t. ! queue ! videocrop left=4 right=4 ! filesink location=\"test.crop.origin.log\" sync=true" 10-1 0 0 $PERFORMANCE
+callCompareTest test.crop.origin.log test.crop.log 10-2 "Video meta stride Test" 0 0
+
+# Heavy crop, the buffer with video meta is larger than two frames of the cropped video
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=640,height=480,framerate=0/1 ! tee name=t ! queue ! videocrop left=320 ! tensor_converter ! filesink location=\"test.crop320.log\" sync=true t. ! queue ! videocrop left=320 ! filesink location=\"test.crop320.origin.log\" sync=true" 10-3 0 0 $PERFORMANCE
+callCompareTest test.crop320.origin.log test.crop320.log 10-4 "Video meta heavy crop Test" 0 0
+
+# Odd width with tight stride in video meta, the buffer is smaller than the default layout (stride 1914 < 1916)
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=638,height=480,framerate=0/1 ! tensor_converter ! filesink location=\"test.tight.origin.log\" sync=true" 10-5 0 0 $PERFORMANCE
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} filesrc location=\"test.tight.origin.log\" ! rawvideoparse format=rgb width=638 height=480 framerate=0/1 plane-strides=\"<1914>\" ! tensor_converter ! filesink location=\"test.tight.log\" sync=true" 10-6 0 0 $PERFORMANCE
+callCompareTest test.tight.origin.log test.tight.log 10-7 "Video meta tight stride Test" 0 0
+
+##
+## @brief Execute gstreamer pipeline and check the tensor resized and normalized in tensor_converter
+## @param $1 Colorspace
+## @param $2 Channels
+## @param $3 Width of video
+## @param $4 Height of video
+## @param $5 Width of tensor
+## @param $6 Height of tensor
+## @param $7 Type of tensor
+## @param $8 Mean values
+## @param $9 Scale values
+## @param $10 Test Case Number
+function do_test_preproc() {
+    gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=${1},width=${3},height=${4},framerate=0/1 ! tee name=t ! queue ! tensor_converter output-width=${5} output-height=${6} output-type=${7} mean=${8} scale=${9} ! filesink location=\"test.preproc.${10}.log\" sync=true t. ! queue ! filesink location=\"test.preproc.${10}.origin.log\" sync=true" ${10}-1 0 0 $PERFORMANCE
+
+    python checkPreprocTensor.py test.preproc.${10}.origin.log ${2} ${3} ${4} test.preproc.${10}.log ${5} ${6} ${7} ${8} ${9}
+    testResult $? ${10}-2 "Preprocess ${1} ${3}x${4} to ${7} ${5}x${6} Test" 0 1
+}
+
+do_test_preproc RGB 3 160 120 80 60 float32 127.5 0.0078125 11-1
+do_test_preproc RGB 3 160 120 224 224 float32 123.68:116.78:103.94 0.017:0.0175:0.0174 11-2
+do_test_preproc GRAY8 1 162 120 100 50 uint8 0 1 11-3
+do_test_preproc BGRx 4 160 120 160 120 float32 0 0.00392156862745 11-4
+
+# Fail Test: The number of mean values is different from the channels
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=160,height=120,framerate=0/1 ! tensor_converter output-type=float32 mean=127.5:127.5 ! filesink location=\"test.preproc.fail.log\" sync=true" 11F_n 0 1 $PERFORMANCE
+
 # Stream test case (genCase08 in generateGoldenTestResult.py)
 gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"testsequence_%1d.png\" index=0 caps=\"image/png,framerate=\(fraction\)30/1\" ! pngdec ! videoconvert ! tensor_converter ! filesink location=\"testcase08.log\"" 8 0 0 $PERFORMANCE
 callCompareTest testcase08.golden testcase08.log 8 "PNG Stream Test" 0 0
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+
+##
+# Copyright (C) 2019 Samsung Electronics
+# License: LGPL-2.1
+#
+# @file checkResizedTensor.py
+# @brief Check if the resized results (bilinear or area) are correct
+#
+# The results of custom filter "resize" are compared with the values computed
+# with same coefficients. Each element may differ by 1 for rounding (uint8),
+# or by 0.01 for the order of float operations (float32).
+
+import sys
+import math
+import struct
+
+
+def coefficients (insize, outsize, mode):
+  scale = float(insize) / outsize
+  coeff = []
+
+  if mode == 'area' and scale <= 1.0:
+    mode = 'bilinear'
+
+  for i in range(0, outsize):
+    if mode == 'area':
+      start = i * scale
+      end = start + scale
+      taps = []
+      for t in range(int(math.floor(start)), min(int(math.ceil(end)), insize)):
+        overlap = min(end, t + 1.0) - max(start, float(t))
+        if overlap > 0.0:
+          taps.append((t, overlap / scale))
+      coeff.append(taps)
+    else:
+      src = max((i + 0.5) * scale - 0.5, 0.0)
+      x0 = int(math.floor(src))
+      if x0 >= insize - 1:
+        coeff.append([(insize - 1, 1.0)])
+      else:
+        coeff.append([(x0, 1.0 - (src - x0)), (x0 + 1, src - x0)])
+
+  return coeff
+
+
+def compare (data1, width1, height1, data2, width2, height2, innerdim, mode, dtype):
+  if (len(data1) * width2 * height2) != (len(data2) * width1 * height1):
+    print(str(len(data1) * width2 * height2)+" / "+str(len(data2) * width1 * height1))
+    return 1
+
+  cx = coefficients(width1, width2, mode)
+  cy = coefficients(height1, height2, mode)
+
+  count = 0
+  count2 = 0
+  while (count < len(data1)):
+    for y in range(0, height2):
+      for x in range(0, width2):
+        for c in range(0, innerdim):
+          value = 0.0
+          for (iy, wy) in cy[y]:
+            for (ix, wx) in cx[x]:
+              value += wy * wx * data1[count + c + ix * innerdim + iy * width1 * innerdim]
+          if dtype == 'float32':
+            expected = value
+            tolerance = 0.01
+          else:
+            expected = min(max(int(value + 0.5), 0), 255)
+            tolerance = 1
+          if abs(data2[count2 + c + x * innerdim + y * width2 * innerdim] - expected) > tolerance:
+            print("At "+str(x)+","+str(y))
+            return 5
+    count = count + innerdim * width1 * height1
+    count2 = count2 + innerdim * width2 * height2
+
+  return 0
+
+def readfile (filename, dtype):
+  F = open(filename, 'rb')
+  if dtype == 'float32':
+    data = F.read()
+    readfile = struct.unpack('<' + str(len(data) // 4) + 'f', data)
+  else:
+    readfile = bytearray(F.read())
+  F.close()
+  return readfile
+
+
+if len(sys.argv) != 9 and len(sys.argv) != 10:
+  exit(9)
+
+dtype = sys.argv[9] if len(sys.argv) == 10 else 'uint8'
+
+data1 = readfile(sys.argv[1], dtype)
+width1 = int(sys.argv[2])
+height1 = int(sys.argv[3])
+data2 = readfile(sys.argv[4], dtype)
+width2 = int(sys.argv[5])
+height2 = int(sys.argv[6])
+innerdim = int(sys.argv[7])
+mode = sys.argv[8]
+
+exit(compare(data1, width1, height1, data2, width2, height2, innerdim, mode, dtype))
@@ -84,6 +84,14 @@ gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} tensor_mux name=mux ! tee name=t !
 
 callCompareTest testcase04.tensors.direct.log testcase04.tensors.passthrough.log 4-4 "Compare 4-4" 0 0
 
+# Test the frames in a batch with invoke_batch (4-5, 4-6, 4-7F_n)
+# With custom property "batch-only", the filter fails to invoke a single frame, so only invoke_batch can pass.
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=8 ! video/x-raw,format=RGB,width=160,height=120,framerate=30/1 ! tensor_converter frames-per-tensor=4 ! tee name=t ! queue ! tensor_filter framework=\"custom\" model=\"${PATH_TO_MODEL_V}\" custom=batch-only ! filesink location=\"testcase04.batch.passthrough.log\" sync=true t. ! queue ! filesink location=\"testcase04.batch.direct.log\" sync=true" 4-5 0 0 $PERFORMANCE
+
+callCompareTest testcase04.batch.direct.log testcase04.batch.passthrough.log 4-6 "Compare 4-6" 0 0
+
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=8 ! video/x-raw,format=RGB,width=160,height=120,framerate=30/1 ! tensor_converter ! tensor_filter framework=\"custom\" model=\"${PATH_TO_MODEL_V}\" custom=batch-only ! fakesink" 4-7F_n 0 1 $PERFORMANCE
+
 # Test scaler (5, 6, 7)
 if [[ -z "${CUSTOMLIB_DIR}" ]]; then
     PATH_TO_MODEL_S="../../build/nnstreamer_example/custom_example_scaler/libnnstreamer_customfilter_scaler.${SO_EXT}"
@@ -127,6 +135,34 @@ gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/
 python checkScaledTensor.py testcase11.direct.log 640 480 testcase11.scaled.log 320 240 3
 testResult $? 11 "Golden test comparison" 0 1
 
+# Test resize (16, 17, 18)
+if [[ -z "${CUSTOMLIB_DIR}" ]]; then
+    PATH_TO_MODEL_R="../../build/ext/nnstreamer/custom_filter/libnnstreamer_customfilter_resize.${SO_EXT}"
+else
+    PATH_TO_MODEL_R="${CUSTOMLIB_DIR}/libnnstreamer_customfilter_resize.${SO_EXT}"
+fi
+
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=640,height=480,framerate=0/1 ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tee name=t ! queue ! tensor_filter framework=\"custom\" model=\"${PATH_TO_MODEL_R}\" custom=\"320x240,mode:nearest,threads:2\" ! filesink location=\"testcase16.resized.log\" sync=true t. ! queue ! filesink location=\"testcase16.direct.log\" sync=true" 16 0 0 $PERFORMANCE
+python checkScaledTensor.py testcase16.direct.log 640 480 testcase16.resized.log 320 240 3
+testResult $? 16 "Golden test comparison" 0 1
+
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=160,height=120,framerate=0/1 ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tee name=t ! queue ! tensor_filter framework=\"custom\" model=\"${PATH_TO_MODEL_R}\" custom=\"100x75,mode:bilinear,threads:3\" ! filesink location=\"testcase17.resized.log\" sync=true t. ! queue ! filesink location=\"testcase17.direct.log\" sync=true" 17 0 0 $PERFORMANCE
+python checkResizedTensor.py testcase17.direct.log 160 120 testcase17.resized.log 100 75 3 bilinear
+testResult $? 17 "Golden test comparison" 0 1
+
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=160,height=120,framerate=0/1 ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tee name=t ! queue ! tensor_filter framework=\"custom\" model=\"${PATH_TO_MODEL_R}\" custom=\"64x48,mode:area\" ! filesink location=\"testcase18.resized.log\" sync=true t. ! queue ! filesink location=\"testcase18.direct.log\" sync=true" 18 0 0 $PERFORMANCE
+python checkResizedTensor.py testcase18.direct.log 160 120 testcase18.resized.log 64 48 3 area
+testResult $? 18 "Golden test comparison" 0 1
+
+# Test resize with float32 tensors (19, 20)
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=160,height=120,framerate=0/1 ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tensor_transform mode=typecast option=float32 ! tee name=t ! queue ! tensor_filter framework=\"custom\" model=\"${PATH_TO_MODEL_R}\" custom=\"100x75,mode:bilinear,threads:2\" ! filesink location=\"testcase19.resized.log\" sync=true t. ! queue ! filesink location=\"testcase19.direct.log\" sync=true" 19 0 0 $PERFORMANCE
+python checkResizedTensor.py testcase19.direct.log 160 120 testcase19.resized.log 100 75 3 bilinear float32
+testResult $? 19 "Golden test comparison" 0 1
+
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=160,height=120,framerate=0/1 ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tensor_transform mode=typecast option=float32 ! tee name=t ! queue ! tensor_filter framework=\"custom\" model=\"${PATH_TO_MODEL_R}\" custom=\"64x48,mode:area\" ! filesink location=\"testcase20.resized.log\" sync=true t. ! queue ! filesink location=\"testcase20.direct.log\" sync=true" 20 0 0 $PERFORMANCE
+python checkResizedTensor.py testcase20.direct.log 160 120 testcase20.resized.log 64 48 3 area float32
+testResult $? 20 "Golden test comparison" 0 1
+
 # OpenCV Test
 # Test scaler using OpenCV (12, 13, 14)
 if [ "$TEST_OPENCV" == "YES" ]; then
@@ -0,0 +1,58 @@
+##
+# Copyright (C) 2019 Samsung Electronics
+# License: LGPL-2.1
+#
+# @file    batch_passthrough.py
+# @brief   Python custom filter example: passthrough with invoke_batch
+#
+# 'invoke' receives the n-D arrays of a single frame, and 'invoke_batch'
+# receives the list of frames when the outermost dimension of the input
+# tensors is larger than 1.
+
+import numpy as np
+import nnstreamer_python as nns
+
+## @brief  User-defined custom filter; DO NOT CHANGE CLASS NAME
+class CustomFilter(object):
+
+## @brief  The constructor for custom filter: passthrough
+#  @param  None
+  def __init__ (self, *args):
+    self.input_dims = []
+    self.output_dims = []
+
+## @brief  Python callback: setInputDim
+#  @param  Input dimensions: list of nns.TensorShape
+#  @return Output dimensions: same as the input dimensions
+  def setInputDim (self, input_dims):
+    self.input_dims = input_dims
+    self.output_dims = [nns.TensorShape(dims.getDims(), dims.getType())
+                        for dims in input_dims]
+    return self.output_dims
+
+## @brief  Python callback: invoke
+#  @param  Input tensors: list of n-D numpy arrays (in reverse order of tensor dimension)
+#  @return Output tensors: list of output numpy arrays
+  def invoke (self, input_array):
+    for i in range(len(input_array)):
+      shape = list(self.input_dims[i].getDims()[::-1])
+      if list(input_array[i].shape) != shape:
+        raise ValueError("Invalid shape of input array %d" % i)
+      # the batch should be passed to invoke_batch
+      if shape[0] != 1:
+        raise ValueError("invoke is called with %d frames" % shape[0])
+    return input_array
+
+## @brief  Python callback: invoke_batch
+#  @param  Input frames: list of frames, each frame is the list of n-D numpy arrays with the outermost dimension 1
+#  @return Output frames: list of frames, each frame is the list of output numpy arrays
+  def invoke_batch (self, frames):
+    outputs = []
+    for frame in frames:
+      for i in range(len(frame)):
+        shape = list(self.input_dims[i].getDims()[::-1])
+        shape[0] = 1
+        if list(frame[i].shape) != shape:
+          raise ValueError("Invalid shape of input array %d in frame" % i)
+      outputs.append([np.copy(array) for array in frame])
+    return outputs
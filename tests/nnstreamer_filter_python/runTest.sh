@@ -51,6 +51,10 @@ PATH_TO_SCRIPT="python/passthrough.py"
 gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/x-raw,format=RGB,width=280,height=40,framerate=0/1 ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tee name=t ! queue ! tensor_filter framework=\"${FRAMEWORK}\" model=\"${PATH_TO_SCRIPT}\" input=\"3:280:40\" inputtype=\"uint8\" output=\"3:280:40\" outputtype=\"uint8\" ! filesink location=\"testcase1.passthrough.log\" sync=true t. ! queue ! filesink location=\"testcase1.direct.log\" sync=true" 1 0 0 $PERFORMANCE
 callCompareTest testcase1.direct.log testcase1.passthrough.log 1 "Compare 1" 0 0
 
+# Passthrough test with multiple frames (the input arrays are reused and 'invoke' is called with the interned name)
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=10 pattern=ball ! video/x-raw,format=RGB,width=280,height=40,framerate=0/1 ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tee name=t ! queue ! tensor_filter framework=\"${FRAMEWORK}\" model=\"${PATH_TO_SCRIPT}\" input=\"3:280:40\" inputtype=\"uint8\" output=\"3:280:40\" outputtype=\"uint8\" ! filesink location=\"testcase1_2.passthrough.log\" sync=true t. ! queue ! filesink location=\"testcase1_2.direct.log\" sync=true" 1-2 0 0 $PERFORMANCE
+callCompareTest testcase1_2.direct.log testcase1_2.passthrough.log 1-2 "Compare 1-2" 0 0
+
 # Scaler test
 # 1) 640x480 --> 320x240
 PATH_TO_SCRIPT="python/scaler.py"
@@ -65,4 +69,14 @@ gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=1 ! video/
 python checkScaledTensor.py testcase3.direct.log 640 480 testcase3.scaled.log 1280 960 3
 testResult $? 3 "Golden test comparison" 0 1
 
+# Script with invoke_batch
+PATH_TO_SCRIPT="python/batch_passthrough.py"
+# 1) single frame, 'invoke' is called with the n-D arrays
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=4 pattern=ball ! video/x-raw,format=RGB,width=280,height=40,framerate=0/1 ! tensor_converter ! tee name=t ! queue ! tensor_filter framework=\"${FRAMEWORK}\" model=\"${PATH_TO_SCRIPT}\" ! filesink location=\"testcase4.passthrough.log\" sync=true t. ! queue ! filesink location=\"testcase4.direct.log\" sync=true" 4 0 0 $PERFORMANCE
+callCompareTest testcase4.direct.log testcase4.passthrough.log 4 "Compare 4" 0 0
+
+# 2) 4 frames in a tensor (outermost dimension), 'invoke_batch' is called with the list of frames
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc num-buffers=8 pattern=ball ! video/x-raw,format=RGB,width=280,height=40,framerate=0/1 ! tensor_converter ! tensor_aggregator frames-out=4 frames-flush=4 frames-dim=3 ! tee name=t ! queue ! tensor_filter framework=\"${FRAMEWORK}\" model=\"${PATH_TO_SCRIPT}\" ! filesink location=\"testcase5.batch.log\" sync=true t. ! queue ! filesink location=\"testcase5.direct.log\" sync=true" 5 0 0 $PERFORMANCE
+callCompareTest testcase5.direct.log testcase5.batch.log 5 "Compare 5" 0 0
+
 report
@@ -70,6 +70,11 @@ gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} filesrc location=${PATH_TO_IMAGE} !
 python checkLabel.py tensorfilter.out.log ${PATH_TO_IMAGE}
 testResult $? 1 "Golden test comparison" 0 1
 
+# Test with thread and optimization options
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} filesrc location=${PATH_TO_IMAGE} ! pngdec ! videoscale ! imagefreeze ! videoconvert ! video/x-raw,format=GRAY8,framerate=0/1 ! tensor_converter ! tensor_filter framework=pytorch model=${PATH_TO_MODEL} input=1:28:28:1 inputtype=uint8 output=10:1:1:1 outputtype=uint8 custom=num_threads:2,interop_threads:1,optimize:true ! filesink location=tensorfilter.out.log" 4 0 0 $PERFORMANCE
+python checkLabel.py tensorfilter.out.log ${PATH_TO_IMAGE}
+testResult $? 4 "Golden test comparison with custom options" 0 1
+
 # Fail test for invalid input properties
 gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} filesrc location=${PATH_TO_IMAGE} ! pngdec ! videoscale ! imagefreeze ! videoconvert ! video/x-raw,format=GRAY8,framerate=0/1 ! tensor_converter ! tensor_filter framework=pytorch model=${PATH_TO_MODEL} input=7:1 inputtype=float32 ! filesink location=tensorfilter.out.log" 2F_n 0 1 $PERFORMANCE
 
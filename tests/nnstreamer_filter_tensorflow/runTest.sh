@@ -73,6 +73,18 @@ gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} filesrc location=${PATH_TO_DATA} !
 python checkLabel.py tensorfilter.out.1.log 9
 testResult $? 1 "Golden test comparison" 0 1
 
+# Test with session options (thread pools and graph optimizers)
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} filesrc location=${PATH_TO_DATA} ! application/octet-stream ! tensor_converter input-dim=784:1 input-type=uint8 ! tensor_transform mode=arithmetic option=typecast:float32,add:-127.5,div:127.5 ! tensor_filter framework=tensorflow model=${PATH_TO_MODEL} input=784:1:1:1 inputtype=float32 inputname=input output=10:1:1:1 outputtype=float32 outputname=softmax custom=intra_op_threads:2,inter_op_threads:1,per_session_threads:true,constant_folding:true,layout_optimizer:false ! filesink location=tensorfilter.out.3.log " 3 0 0 $PERFORMANCE
+python checkLabel.py tensorfilter.out.3.log 9
+testResult $? 3 "Golden test comparison with session options" 0 1
+
+# Test with the config file whose path contains ',' (empty ConfigProto, the options are applied over it)
+touch "tf_session,config.pb"
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} filesrc location=${PATH_TO_DATA} ! application/octet-stream ! tensor_converter input-dim=784:1 input-type=uint8 ! tensor_transform mode=arithmetic option=typecast:float32,add:-127.5,div:127.5 ! tensor_filter framework=tensorflow model=${PATH_TO_MODEL} input=784:1:1:1 inputtype=float32 inputname=input output=10:1:1:1 outputtype=float32 outputname=softmax custom=intra_op_threads:2,config:tf_session,config.pb ! filesink location=tensorfilter.out.3-1.log " 3-1 0 0 $PERFORMANCE
+python checkLabel.py tensorfilter.out.3-1.log 9
+testResult $? 3-1 "Golden test comparison with the config file" 0 1
+rm -f "tf_session,config.pb"
+
 # Test with speech command model (.wav file, answer is 'yes', this model has a input type DT_STRING.)
 PATH_TO_MODEL="../test_models/models/conv_actions_frozen.pb"
 PATH_TO_DATA="../test_models/data/yes.wav"
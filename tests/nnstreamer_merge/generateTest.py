@@ -103,3 +103,23 @@ for n in range(0,3):
 
 with open("batch.golden", 'wb') as file:
     file.write(out)
+
+#merge with channel direction (interleave two uint8 tensors with a channel)
+width = 100
+height= 50
+
+buf=[]
+
+for n in range(0,2):
+    data = [random.randrange(256) for i in range(0, width * height)]
+    with open("interleave_0" + str(n) + ".dat", 'wb') as file:
+        file.write(bytearray(data))
+    buf.append(data)
+
+out = b''
+for i in range(0, width * height):
+    for n in range(0,2):
+        out += pack('B', buf[n][i])
+
+with open("interleave.golden", 'wb') as file:
+    file.write(out)
@@ -70,6 +70,33 @@ gstTest "--gst-plugin-path=${PATH_TO_PLUGIN}  tensor_merge name=merge mode=linea
 
 callCompareTest batch.golden batch.log 10 "Compare 10" 1 0
 
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN}  tensor_merge name=merge mode=linear option=0 ! filesink location=interleave.log filesrc location=interleave_00.dat blocksize=5000 num_buffers=1 ! application/octet-stream ! tensor_converter input-dim=1:100:50:1 input-type=uint8 ! merge.sink_0 filesrc location=interleave_01.dat blocksize=5000 num_buffers=1 ! application/octet-stream ! tensor_converter input-dim=1:100:50:1 input-type=uint8 ! merge.sink_1" 10-1 0 0 $PERFORMANCE
+
+callCompareTest interleave.golden interleave.log 10-1 "Compare 10-1" 1 0
+
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN}  tensor_merge name=merge mode=linear option=3 zero-copy=true ! filesink location=batch_zerocopy.log filesrc location=batch_1.dat blocksize=60000 num_buffers=1 ! application/octet-stream ! tensor_converter input-dim=3:100:50:1 input-type=float32 ! merge.sink_0 filesrc location=batch_2.dat blocksize=120000 num_buffers=1 ! application/octet-stream ! tensor_converter input-dim=3:100:50:2 input-type=float32 ! merge.sink_1 filesrc location=batch_3.dat blocksize=180000 num_buffers=1 ! application/octet-stream ! tensor_converter input-dim=3:100:50:3 input-type=float32 ! merge.sink_2" 10-2 0 0 $PERFORMANCE
+
+callCompareTest batch.golden batch_zerocopy.log 10-2 "Compare 10-2" 1 0
+
+# Test zero-copy merged tensor (multiple memory blocks) with tensor_filter
+if [ -z ${SO_EXT} ]; then
+    SO_EXT="so"
+fi
+
+if [ ! -d "${PATH_TO_PLUGIN}" ]; then
+    CUSTOMLIB_DIR=${CUSTOMLIB_DIR:="/usr/lib/nnstreamer/customfilters"}
+fi
+
+if [[ -z "${CUSTOMLIB_DIR}" ]]; then
+    PATH_TO_MODEL_V="../../build/nnstreamer_example/custom_example_passthrough/libnnstreamer_customfilter_passthrough_variable.${SO_EXT}"
+else
+    PATH_TO_MODEL_V="${CUSTOMLIB_DIR}/libnnstreamer_customfilter_passthrough_variable.${SO_EXT}"
+fi
+
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN}  tensor_merge name=merge mode=linear option=3 zero-copy=true ! tensor_filter framework=custom model=${PATH_TO_MODEL_V} ! filesink location=batch_zerocopy_filter.log filesrc location=batch_1.dat blocksize=60000 num_buffers=1 ! application/octet-stream ! tensor_converter input-dim=3:100:50:1 input-type=float32 ! merge.sink_0 filesrc location=batch_2.dat blocksize=120000 num_buffers=1 ! application/octet-stream ! tensor_converter input-dim=3:100:50:2 input-type=float32 ! merge.sink_1 filesrc location=batch_3.dat blocksize=180000 num_buffers=1 ! application/octet-stream ! tensor_converter input-dim=3:100:50:3 input-type=float32 ! merge.sink_2" 10-3 0 0 $PERFORMANCE
+
+callCompareTest batch.golden batch_zerocopy_filter.log 10-3 "Compare 10-3" 1 0
+
 gstTest "--gst-plugin-path=${PATH_TO_PLUGIN}  tensor_merge name=merge mode=linear option=2 silent=true sync_mode=slowest ! multifilesink location=testsynch00_%1d.log multifilesrc location=\"testsequence03_%1d.png\" index=0 caps=\"image/png, framerate=(fraction)30/1\" ! pngdec ! tensor_converter ! merge.sink_0 multifilesrc location=\"testsequence03_%1d.png\" index=0 caps=\"image/png, framerate=(fraction)10/1\" ! pngdec ! tensor_converter ! merge.sink_1" 11 0 0 $PERFORMANCE
 
 callCompareTest testsynch00_0.golden testsynch00_0.log 11-1 "Compare 11-1" 1 0
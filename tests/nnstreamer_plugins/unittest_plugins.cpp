@@ -1582,6 +1582,673 @@ TEST (test_tensor_aggregator, aggregate_5)
   gst_harness_teardown (h);
 }
 
+/**
+ * @brief Test for tensor_aggregator (concatenate overlapping frames with frames-dim 1 and frames-flush 1)
+ */
+TEST (test_tensor_aggregator, aggregate_6)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorConfig config;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i, j, k;
+  gsize data_in_size, data_out_size;
+  const gint *first, *second;
+
+  h = gst_harness_new ("tensor_aggregator");
+
+  g_object_set (h->element, "frames-out", 2, "frames-flush", 1,
+      "frames-dim", 1, NULL);
+
+  /* input tensor info */
+  config.info.type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+  data_in_size = gst_tensor_info_get_size (&config.info);
+
+  gst_tensor_parse_dimension ("3:8:2:2", config.info.dimension);
+  data_out_size = gst_tensor_info_get_size (&config.info);
+
+  /* push 3 buffers (frame 1, 2 and 1) */
+  for (i = 0; i < 3; i++) {
+    /* set input buffer */
+    in_buf = gst_harness_create_buffer (h, data_in_size);
+
+    mem = gst_buffer_peek_memory (in_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+    memcpy (info.data, aggr_test_frames[i % 2], data_in_size);
+
+    gst_memory_unmap (mem, &info);
+
+    GST_BUFFER_PTS (in_buf) = i * 10 * GST_MSECOND;
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  /* 2 output buffers, each frame is included in overlapping output */
+  EXPECT_EQ (gst_harness_buffers_received (h), 2U);
+
+  for (i = 0; i < 2; i++) {
+    out_buf = gst_harness_pull (h);
+
+    ASSERT_TRUE (out_buf != NULL);
+    ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+    ASSERT_EQ (gst_buffer_get_size (out_buf), data_out_size);
+    EXPECT_EQ (GST_BUFFER_PTS (out_buf), i * 10 * GST_MSECOND);
+
+    mem = gst_buffer_peek_memory (out_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+
+    /* rows of 12 elements (3:4) are interleaved */
+    first = aggr_test_frames[i % 2];
+    second = aggr_test_frames[(i + 1) % 2];
+
+    for (j = 0; j < 4; j++) {
+      for (k = 0; k < 12; k++) {
+        EXPECT_EQ (((gint *) info.data)[j * 24 + k], first[j * 12 + k]);
+        EXPECT_EQ (((gint *) info.data)[j * 24 + 12 + k], second[j * 12 + k]);
+      }
+    }
+
+    gst_memory_unmap (mem, &info);
+    gst_buffer_unref (out_buf);
+  }
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_aggregator (overlapping windows with frames-flush, out-dimension 3:4:2:6)
+ */
+TEST (test_tensor_aggregator, aggregate_7)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf[3];
+  GstTensorConfig config;
+  GstMemory *mem;
+  GstMapInfo info, prev_info;
+  guint i, j;
+  gsize data_in_size, data_out_size;
+
+  h = gst_harness_new ("tensor_aggregator");
+
+  g_object_set (h->element, "frames-out", 3, "frames-flush", 1, NULL);
+
+  /* input tensor info */
+  config.info.type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+  data_in_size = gst_tensor_info_get_size (&config.info);
+  data_out_size = data_in_size * 3;
+
+  /* push 5 buffers */
+  for (i = 0; i < 5; i++) {
+    /* set input buffer */
+    in_buf = gst_harness_create_buffer (h, data_in_size);
+
+    mem = gst_buffer_peek_memory (in_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+    for (j = 0; j < 48; j++) {
+      ((gint *) info.data)[j] = i * 100 + j;
+    }
+
+    gst_memory_unmap (mem, &info);
+
+    GST_BUFFER_PTS (in_buf) = i * 10 * GST_MSECOND;
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  /* 3 windows, flush 1 frame after pushing a window */
+  EXPECT_EQ (gst_harness_buffers_received (h), 3U);
+
+  for (i = 0; i < 3; i++) {
+    out_buf[i] = gst_harness_pull (h);
+
+    ASSERT_TRUE (out_buf[i] != NULL);
+    ASSERT_EQ (gst_buffer_n_memory (out_buf[i]), 1U);
+    ASSERT_EQ (gst_buffer_get_size (out_buf[i]), data_out_size);
+    EXPECT_EQ (GST_BUFFER_PTS (out_buf[i]), i * 10 * GST_MSECOND);
+
+    mem = gst_buffer_peek_memory (out_buf[i], 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+
+    for (j = 0; j < 144; j++) {
+      EXPECT_EQ (((gint *) info.data)[j], (gint) ((i + j / 48) * 100 + j % 48));
+    }
+
+    if (i > 0) {
+      /* the windows share the frames */
+      mem = gst_buffer_peek_memory (out_buf[i - 1], 0);
+      ASSERT_TRUE (gst_memory_map (mem, &prev_info, GST_MAP_READ));
+      EXPECT_TRUE (prev_info.data + data_in_size == info.data);
+      gst_memory_unmap (mem, &prev_info);
+    }
+
+    gst_memory_unmap (gst_buffer_peek_memory (out_buf[i], 0), &info);
+  }
+
+  for (i = 0; i < 3; i++)
+    gst_buffer_unref (out_buf[i]);
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_aggregator (other/tensors, frames-dim 1 and 3 for each tensor)
+ */
+TEST (test_tensor_aggregator, aggregate_tensors)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorsConfig config;
+  GstCaps *caps;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i, j, k;
+  gchar *str;
+
+  h = gst_harness_new ("tensor_aggregator");
+
+  g_object_set (h->element, "frames-out", 2, "frames-dims", "1,3", NULL);
+  g_object_get (h->element, "frames-dims", &str, NULL);
+  EXPECT_STREQ (str, "1,3");
+  g_free (str);
+
+  /* input tensors info (data 3:4:2:2 int32 and mask 2:1:1:1 uint8) */
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 2;
+  config.info.info[0].type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", config.info.info[0].dimension);
+  config.info.info[1].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("2:1:1:1", config.info.info[1].dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensors_caps_from_config (&config));
+
+  /* push buffers */
+  for (i = 0; i < 2; i++) {
+    /* set input buffer */
+    in_buf = gst_buffer_new ();
+
+    mem = gst_allocator_alloc (NULL, 48 * sizeof (gint), NULL);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+    memcpy (info.data, aggr_test_frames[i], 48 * sizeof (gint));
+    gst_memory_unmap (mem, &info);
+    gst_buffer_append_memory (in_buf, mem);
+
+    mem = gst_allocator_alloc (NULL, 2, NULL);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+    info.data[0] = (guint8) (i * 2 + 1);
+    info.data[1] = (guint8) (i * 2 + 2);
+    gst_memory_unmap (mem, &info);
+    gst_buffer_append_memory (in_buf, mem);
+
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  /* check output caps */
+  caps = gst_pad_get_current_caps (h->sinkpad);
+  ASSERT_TRUE (caps != NULL);
+  EXPECT_TRUE (gst_tensors_config_from_structure (&config,
+          gst_caps_get_structure (caps, 0)));
+  EXPECT_EQ (config.info.num_tensors, 2U);
+  EXPECT_EQ (config.info.info[0].dimension[1], 8U);
+  EXPECT_EQ (config.info.info[1].dimension[3], 2U);
+  gst_caps_unref (caps);
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 2U);
+
+  /* 1st tensor, concatenated with frames-dim 1 (3:8:2:2) */
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+  ASSERT_EQ (info.size, 96 * sizeof (gint));
+
+  for (j = 0; j < 4; j++) {
+    for (k = 0; k < 12; k++) {
+      EXPECT_EQ (((gint *) info.data)[j * 24 + k],
+          aggr_test_frames[0][j * 12 + k]);
+      EXPECT_EQ (((gint *) info.data)[j * 24 + 12 + k],
+          aggr_test_frames[1][j * 12 + k]);
+    }
+  }
+
+  gst_memory_unmap (mem, &info);
+
+  /* 2nd tensor, aggregated with frames-dim 3 (2:1:1:2) */
+  mem = gst_buffer_peek_memory (out_buf, 1);
+  ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+  ASSERT_EQ (info.size, 4U);
+
+  for (j = 0; j < 4; j++) {
+    EXPECT_EQ (info.data[j], j + 1);
+  }
+
+  gst_memory_unmap (mem, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter (overlapping windows of audio frames with frames-hop)
+ */
+TEST (test_tensor_converter, frames_hop)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i, j;
+  gint16 *samples;
+
+  h = gst_harness_new ("tensor_converter");
+
+  /* 100 ms windows with 25 ms hop */
+  g_object_set (h->element, "frames-per-tensor", 100, "frames-hop", 25, NULL);
+
+  gst_harness_set_src_caps_str (h,
+      "audio/x-raw,format=S16LE,rate=1000,channels=1,layout=interleaved");
+
+  /* push 4 buffers (50 samples, 50 ms) */
+  for (i = 0; i < 4; i++) {
+    in_buf = gst_harness_create_buffer (h, 50 * sizeof (gint16));
+
+    mem = gst_buffer_peek_memory (in_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+    samples = (gint16 *) info.data;
+    for (j = 0; j < 50; j++) {
+      samples[j] = (gint16) (i * 50 + j);
+    }
+
+    gst_memory_unmap (mem, &info);
+
+    GST_BUFFER_PTS (in_buf) = i * 50 * GST_MSECOND;
+    GST_BUFFER_DURATION (in_buf) = 50 * GST_MSECOND;
+
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  /* 200 samples, 5 windows */
+  EXPECT_EQ (gst_harness_buffers_received (h), 5U);
+
+  for (i = 0; i < 5; i++) {
+    out_buf = gst_harness_pull (h);
+
+    ASSERT_TRUE (out_buf != NULL);
+    ASSERT_EQ (gst_buffer_get_size (out_buf), 100 * sizeof (gint16));
+    EXPECT_EQ (GST_BUFFER_PTS (out_buf), i * 25 * GST_MSECOND);
+    EXPECT_EQ (GST_BUFFER_DURATION (out_buf), 100 * GST_MSECOND);
+
+    ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+
+    samples = (gint16 *) info.data;
+    for (j = 0; j < 100; j++) {
+      EXPECT_EQ (samples[j], (gint16) (i * 25 + j));
+    }
+
+    gst_buffer_unmap (out_buf, &info);
+    gst_buffer_unref (out_buf);
+  }
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_split (the segment shares the memory of incoming buffer)
+ */
+TEST (test_tensor_split, split_shared)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorConfig config;
+  GstMemory *mem;
+  GstMapInfo in_info, out_info;
+  guint i;
+
+  h = gst_harness_new_with_padnames ("tensor_split", "sink", "src_0");
+
+  /* pick the second segment */
+  g_object_set (h->element, "tensorseg", "4:1:1:1,4:1:1:1", "tensorpick", "1",
+      NULL);
+
+  /* input tensor info */
+  config.info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("4:2:1:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+
+  /* set input buffer */
+  in_buf = gst_harness_create_buffer (h, 8);
+
+  mem = gst_buffer_peek_memory (in_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &in_info, GST_MAP_WRITE));
+
+  for (i = 0; i < 8; i++) {
+    in_info.data[i] = i + 1;
+  }
+
+  gst_memory_unmap (mem, &in_info);
+
+  gst_buffer_ref (in_buf);
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), 4U);
+
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &out_info, GST_MAP_READ));
+  ASSERT_TRUE (gst_buffer_map (in_buf, &in_info, GST_MAP_READ));
+
+  /* no copy, the second half of incoming buffer */
+  EXPECT_TRUE (out_info.data == in_info.data + 4);
+
+  for (i = 0; i < 4; i++) {
+    EXPECT_EQ (out_info.data[i], i + 5);
+  }
+
+  gst_buffer_unmap (in_buf, &in_info);
+  gst_memory_unmap (mem, &out_info);
+
+  gst_buffer_unref (out_buf);
+  gst_buffer_unref (in_buf);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_split (the memory which cannot be shared is copied)
+ */
+TEST (test_tensor_split, split_no_share)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorConfig config;
+  GstMemory *mem;
+  GstMapInfo in_info, out_info;
+  guint i;
+
+  h = gst_harness_new_with_padnames ("tensor_split", "sink", "src_0");
+
+  /* pick the second segment */
+  g_object_set (h->element, "tensorseg", "4:1:1:1,4:1:1:1", "tensorpick", "1",
+      NULL);
+
+  /* input tensor info */
+  config.info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("4:2:1:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+
+  /* set input buffer with the memory which cannot be shared */
+  mem = gst_allocator_alloc (NULL, 8, NULL);
+  GST_MINI_OBJECT_FLAG_SET (mem, GST_MEMORY_FLAG_NO_SHARE);
+  ASSERT_TRUE (gst_memory_map (mem, &in_info, GST_MAP_WRITE));
+
+  for (i = 0; i < 8; i++) {
+    in_info.data[i] = i + 1;
+  }
+
+  gst_memory_unmap (mem, &in_info);
+
+  in_buf = gst_buffer_new ();
+  gst_buffer_append_memory (in_buf, mem);
+
+  gst_buffer_ref (in_buf);
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), 4U);
+
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &out_info, GST_MAP_READ));
+  ASSERT_TRUE (gst_buffer_map (in_buf, &in_info, GST_MAP_READ));
+
+  /* copied, the second half of incoming buffer */
+  EXPECT_TRUE (out_info.data != in_info.data + 4);
+
+  for (i = 0; i < 4; i++) {
+    EXPECT_EQ (out_info.data[i], i + 5);
+  }
+
+  gst_buffer_unmap (in_buf, &in_info);
+  gst_memory_unmap (mem, &out_info);
+
+  gst_buffer_unref (out_buf);
+  gst_buffer_unref (in_buf);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for the latency property of tensor_mux and tensor_merge.
+ */
+TEST (test_tensor_time_sync, latency_property)
+{
+  const gchar *elements[] = { "tensor_mux", "tensor_merge" };
+  GstElement *element;
+  guint64 latency;
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (elements); i++) {
+    element = gst_element_factory_make (elements[i], NULL);
+    ASSERT_TRUE (element != NULL);
+
+    /** default latency is 0 (no additional latency) */
+    g_object_get (element, "latency", &latency, NULL);
+    EXPECT_EQ (latency, 0U);
+
+    g_object_set (element, "latency", (guint64) (30 * GST_MSECOND), NULL);
+    g_object_get (element, "latency", &latency, NULL);
+    EXPECT_EQ (latency, (guint64) (30 * GST_MSECOND));
+
+    gst_object_unref (element);
+  }
+}
+
+/**
+ * @brief Test for the latency query of tensor_mux and tensor_merge with live sources.
+ */
+TEST (test_tensor_time_sync, latency_query)
+{
+  const gchar *elements[] = { "tensor_mux", "tensor_merge" };
+  GstHarness *h0, *h1;
+  GstQuery *query;
+  GstClockTime min, max;
+  gboolean live;
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (elements); i++) {
+    h0 = gst_harness_new_with_padnames (elements[i], "sink_0", "src");
+    h1 = gst_harness_new_with_element (h0->element, "sink_1", NULL);
+
+    g_object_set (h0->element, "latency", (guint64) (30 * GST_MSECOND), NULL);
+
+    /** live sources with the latency 10ms and 20ms */
+    gst_harness_set_upstream_latency (h0, 10 * GST_MSECOND);
+    gst_harness_set_upstream_latency (h1, 20 * GST_MSECOND);
+
+    /** the query from downstream is aggregated from the sink pads */
+    query = gst_query_new_latency ();
+    EXPECT_TRUE (gst_pad_peer_query (h0->sinkpad, query));
+
+    gst_query_parse_latency (query, &live, &min, &max);
+    EXPECT_TRUE (live);
+    EXPECT_EQ (min, 50 * GST_MSECOND);
+    EXPECT_FALSE (GST_CLOCK_TIME_IS_VALID (max));
+    gst_query_unref (query);
+
+    /** no additional latency */
+    g_object_set (h0->element, "latency", (guint64) 0, NULL);
+
+    query = gst_query_new_latency ();
+    EXPECT_TRUE (gst_pad_peer_query (h0->sinkpad, query));
+
+    gst_query_parse_latency (query, &live, &min, &max);
+    EXPECT_TRUE (live);
+    EXPECT_EQ (min, 20 * GST_MSECOND);
+    gst_query_unref (query);
+
+    gst_harness_teardown (h1);
+    gst_harness_teardown (h0);
+  }
+}
+
+/**
+ * @brief Test for resetting the last output of refresh mode.
+ */
+TEST (test_tensor_time_sync, refresh_reset)
+{
+  tensor_time_sync_data sync;
+  gchar option[] = "1:100";
+
+  memset (&sync, 0, sizeof (tensor_time_sync_data));
+  sync.mode = SYNC_REFRESH;
+  sync.option = option;
+
+  EXPECT_TRUE (gst_tensor_time_sync_set_option_data (&sync));
+  EXPECT_EQ (sync.data_refresh.sink_id, 1U);
+  EXPECT_EQ (sync.data_refresh.timeout, (guint64) 100);
+  EXPECT_FALSE (GST_CLOCK_TIME_IS_VALID (sync.data_refresh.last_time));
+
+  /** the first tensors should be pushed again after flush or restart */
+  sync.data_refresh.last_time = 10 * GST_MSECOND;
+  gst_tensor_time_sync_reset (&sync);
+  EXPECT_FALSE (GST_CLOCK_TIME_IS_VALID (sync.data_refresh.last_time));
+}
+
+/**
+ * @brief Push a tensor (uint8, 1:1:1:1) with the value and timestamp.
+ */
+static GstFlowReturn
+_push_refresh_tensor (GstHarness * h, guint8 value, GstClockTime pts)
+{
+  GstBuffer *buf;
+
+  buf = gst_buffer_new_allocate (NULL, 1, NULL);
+  gst_buffer_fill (buf, 0, &value, 1);
+  GST_BUFFER_PTS (buf) = pts;
+
+  return gst_harness_push (h, buf);
+}
+
+/**
+ * @brief Pull the tensors from tensor_mux and check the values and timestamp.
+ */
+static void
+_check_refresh_tensors (GstHarness * h, guint8 value0, guint8 value1,
+    GstClockTime pts)
+{
+  GstBuffer *buf;
+  guint8 value;
+
+  buf = gst_harness_pull (h);
+  ASSERT_TRUE (buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (buf), 2U);
+  EXPECT_EQ (GST_BUFFER_PTS (buf), pts);
+
+  gst_buffer_extract (buf, 0, &value, 1);
+  EXPECT_EQ (value, value0);
+  gst_buffer_extract (buf, 1, &value, 1);
+  EXPECT_EQ (value, value1);
+
+  gst_buffer_unref (buf);
+}
+
+/**
+ * @brief Test for the outputs of refresh mode in tensor_mux (base pad 1, timeout 100ms).
+ */
+TEST (test_tensor_time_sync, refresh_outputs)
+{
+  GstHarness *h0, *h1;
+  GstElement *mux;
+  GstPad *pad;
+  GstTensorConfig config;
+  guint i;
+
+  mux = gst_element_factory_make ("tensor_mux", NULL);
+  ASSERT_TRUE (mux != NULL);
+
+  g_object_set (mux, "sync_mode", "refresh", "sync_option", "1:100000000",
+      NULL);
+
+  /** request the sink pads before starting */
+  for (i = 0; i < 2; i++) {
+    pad = gst_element_get_request_pad (mux, "sink_%u");
+    ASSERT_TRUE (pad != NULL);
+    gst_object_unref (pad);
+  }
+
+  h0 = gst_harness_new_with_element (mux, "sink_0", "src");
+  h1 = gst_harness_new_with_element (mux, "sink_1", NULL);
+
+  gst_tensor_config_init (&config);
+  config.info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("1:1:1:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h0, gst_tensor_caps_from_config (&config));
+  gst_harness_set_src_caps (h1, gst_tensor_caps_from_config (&config));
+
+  /** the first tensors are pushed when the base pad receives a buffer */
+  EXPECT_EQ (_push_refresh_tensor (h0, 0, 0), GST_FLOW_OK);
+  EXPECT_EQ (gst_harness_buffers_received (h0), 0U);
+  EXPECT_EQ (_push_refresh_tensor (h1, 10, 10 * GST_MSECOND), GST_FLOW_OK);
+  EXPECT_EQ (gst_harness_buffers_received (h0), 1U);
+  _check_refresh_tensors (h0, 0, 10, 10 * GST_MSECOND);
+
+  /** the other pad does not wait for the base pad, and does not push the tensors */
+  EXPECT_EQ (_push_refresh_tensor (h0, 1, 20 * GST_MSECOND), GST_FLOW_OK);
+  EXPECT_EQ (_push_refresh_tensor (h0, 2, 25 * GST_MSECOND), GST_FLOW_OK);
+  EXPECT_EQ (gst_harness_buffers_received (h0), 1U);
+
+  /** the most recent buffer of the other pad */
+  EXPECT_EQ (_push_refresh_tensor (h1, 11, 30 * GST_MSECOND), GST_FLOW_OK);
+  EXPECT_EQ (gst_harness_buffers_received (h0), 2U);
+  _check_refresh_tensors (h0, 2, 11, 30 * GST_MSECOND);
+
+  /** the base pad is stalled for the timeout, reuse the last buffer of base pad */
+  EXPECT_EQ (_push_refresh_tensor (h0, 3, 130 * GST_MSECOND), GST_FLOW_OK);
+  EXPECT_EQ (gst_harness_buffers_received (h0), 3U);
+  _check_refresh_tensors (h0, 3, 11, 130 * GST_MSECOND);
+
+  EXPECT_EQ (_push_refresh_tensor (h0, 4, 200 * GST_MSECOND), GST_FLOW_OK);
+  EXPECT_EQ (gst_harness_buffers_received (h0), 3U);
+
+  EXPECT_EQ (_push_refresh_tensor (h1, 12, 210 * GST_MSECOND), GST_FLOW_OK);
+  EXPECT_EQ (gst_harness_buffers_received (h0), 4U);
+  _check_refresh_tensors (h0, 4, 12, 210 * GST_MSECOND);
+
+  gst_harness_teardown (h1);
+  gst_harness_teardown (h0);
+  gst_object_unref (mux);
+}
+
 #ifdef HAVE_ORC
 #include "transform-orc.h"
 
@@ -2668,6 +3335,42 @@ TEST (test_tensor_transform, orc_conv_f64)
   }
 }
 
+/**
+ * @brief Test for orc function to blend and normalize the rows (used in tensor_converter)
+ */
+TEST (test_tensor_transform, orc_blend_norm_f32)
+{
+  const guint array_size = 10;
+  guint i;
+
+  float row0[array_size] = { 0, };
+  float row1[array_size] = { 0, };
+  float scale[array_size] = { 0, };
+  float bias[array_size] = { 0, };
+  float res_f32[array_size] = { 0, };
+
+  for (i = 0; i < array_size; i++) {
+    row0[i] = i * 10.f;
+    row1[i] = i * 20.f + 5.f;
+    scale[i] = (i % 3) + 0.5f;
+    bias[i] = -127.5f * scale[i];
+  }
+
+  nns_orc_blend_norm_f32 (res_f32, row0, row1, scale, bias, .25, array_size);
+
+  for (i = 0; i < array_size; i++) {
+    EXPECT_FLOAT_EQ (res_f32[i],
+        (row0[i] + (row1[i] - row0[i]) * .25f) * scale[i] + bias[i]);
+  }
+
+  /* same rows, normalize only */
+  nns_orc_blend_norm_f32 (res_f32, row0, row0, scale, bias, 0., array_size);
+
+  for (i = 0; i < array_size; i++) {
+    EXPECT_FLOAT_EQ (res_f32[i], (row0[i] - 127.5f) * scale[i]);
+  }
+}
+
 /**
  * @brief Test for tensor_transform orc functions (performance)
  */
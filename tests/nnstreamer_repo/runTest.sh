@@ -111,4 +111,118 @@ callCompareTest testsequence_8.golden testsequence03_2_8.log 3-18 "Compare 3-28"
 callCompareTest testsequence_9.golden testsequence03_2_9.log 3-19 "Compare 3-29" 1 0
 callCompareTest testsequence_10.golden testsequence03_2_10.log 3-10 "Compare 3-30" 1 0
 
+# Slot with 4 buffers, reposink does not wait for reposrc until the slot is full.
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=testsequence_%1d.png index=0 caps=\"image/png,framerate=(fraction)30/1\" ! pngdec ! tensor_converter ! queue ! tensor_reposink silent=false slot-index=0 slot-depth=4 tensor_reposrc silent=false slot-index=0 caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! multifilesink location=testsequence04_%1d.log" 4 0 0 $PERFORMANCE
+
+callCompareTest testsequence_1.golden testsequence04_1.log 4-1 "Compare 4-1" 1 0
+callCompareTest testsequence_2.golden testsequence04_2.log 4-2 "Compare 4-2" 1 0
+callCompareTest testsequence_3.golden testsequence04_3.log 4-3 "Compare 4-3" 1 0
+callCompareTest testsequence_4.golden testsequence04_4.log 4-4 "Compare 4-4" 1 0
+callCompareTest testsequence_5.golden testsequence04_5.log 4-5 "Compare 4-5" 1 0
+callCompareTest testsequence_6.golden testsequence04_6.log 4-6 "Compare 4-6" 1 0
+callCompareTest testsequence_7.golden testsequence04_7.log 4-7 "Compare 4-7" 1 0
+callCompareTest testsequence_8.golden testsequence04_8.log 4-8 "Compare 4-8" 1 0
+callCompareTest testsequence_9.golden testsequence04_9.log 4-9 "Compare 4-9" 1 0
+callCompareTest testsequence_10.golden testsequence04_10.log 4-10 "Compare 4-10" 1 0
+
+# Slot with 4 buffers and a slow reposrc, reposink waits for reposrc when the slot is full and no buffer is dropped.
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=testsequence_%1d.png index=0 caps=\"image/png,framerate=(fraction)30/1\" ! pngdec ! tensor_converter ! queue ! tensor_reposink silent=false slot-index=0 slot-depth=4 tensor_reposrc silent=false slot-index=0 caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! identity sleep-time=100000 ! multifilesink location=testsequence04_1_%1d.log" 4-1 0 0 $PERFORMANCE
+
+callCompareTest testsequence_1.golden testsequence04_1_1.log 4-11 "Compare 4-11" 1 0
+callCompareTest testsequence_2.golden testsequence04_1_2.log 4-12 "Compare 4-12" 1 0
+callCompareTest testsequence_3.golden testsequence04_1_3.log 4-13 "Compare 4-13" 1 0
+callCompareTest testsequence_4.golden testsequence04_1_4.log 4-14 "Compare 4-14" 1 0
+callCompareTest testsequence_5.golden testsequence04_1_5.log 4-15 "Compare 4-15" 1 0
+callCompareTest testsequence_6.golden testsequence04_1_6.log 4-16 "Compare 4-16" 1 0
+callCompareTest testsequence_7.golden testsequence04_1_7.log 4-17 "Compare 4-17" 1 0
+callCompareTest testsequence_8.golden testsequence04_1_8.log 4-18 "Compare 4-18" 1 0
+callCompareTest testsequence_9.golden testsequence04_1_9.log 4-19 "Compare 4-19" 1 0
+callCompareTest testsequence_10.golden testsequence04_1_10.log 4-20 "Compare 4-20" 1 0
+
+# Slot with 4 buffers and drop-oldest, reposink does not wait for the slow reposrc and the oldest buffers are dropped.
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=testsequence_%1d.png index=0 caps=\"image/png,framerate=(fraction)30/1\" ! pngdec ! tensor_converter ! queue ! tensor_reposink silent=false slot-index=0 slot-depth=4 drop-oldest=true tensor_reposrc silent=false slot-index=0 caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! identity sleep-time=200000 ! multifilesink location=testsequence04_2_%1d.log" 4-2 0 0 $PERFORMANCE
+
+# the first buffer is dummy, some buffers should be dropped
+count=$(ls testsequence04_2_*.log | wc -l)
+[ ${count} -lt 11 ]
+testResult $? 4-21 "Drop the oldest buffers" 0 1
+
+# reposrc reads the remaining (latest) buffers in order after EOS
+callCompareTest testsequence_8.golden testsequence04_2_$((count - 3)).log 4-22 "Compare 4-22" 1 0
+callCompareTest testsequence_9.golden testsequence04_2_$((count - 2)).log 4-23 "Compare 4-23" 1 0
+callCompareTest testsequence_10.golden testsequence04_2_$((count - 1)).log 4-24 "Compare 4-24" 1 0
+
+# Broadcast, each tensor_reposrc reads all buffers in the slot.
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=testsequence_%1d.png index=0 caps=\"image/png,framerate=(fraction)30/1\" ! pngdec ! tensor_converter ! queue ! tensor_reposink silent=false slot-index=0 slot-depth=4 broadcast=true tensor_reposrc silent=false slot-index=0 caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! multifilesink location=testsequence05_0_%1d.log tensor_reposrc silent=false slot-index=0 caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! multifilesink location=testsequence05_1_%1d.log" 5 0 0 $PERFORMANCE
+
+callCompareTest testsequence_1.golden testsequence05_0_1.log 5-1 "Compare 5-1" 1 0
+callCompareTest testsequence_2.golden testsequence05_0_2.log 5-2 "Compare 5-2" 1 0
+callCompareTest testsequence_3.golden testsequence05_0_3.log 5-3 "Compare 5-3" 1 0
+callCompareTest testsequence_4.golden testsequence05_0_4.log 5-4 "Compare 5-4" 1 0
+callCompareTest testsequence_5.golden testsequence05_0_5.log 5-5 "Compare 5-5" 1 0
+callCompareTest testsequence_6.golden testsequence05_0_6.log 5-6 "Compare 5-6" 1 0
+callCompareTest testsequence_7.golden testsequence05_0_7.log 5-7 "Compare 5-7" 1 0
+callCompareTest testsequence_8.golden testsequence05_0_8.log 5-8 "Compare 5-8" 1 0
+callCompareTest testsequence_9.golden testsequence05_0_9.log 5-9 "Compare 5-9" 1 0
+callCompareTest testsequence_10.golden testsequence05_0_10.log 5-10 "Compare 5-10" 1 0
+
+callCompareTest testsequence_1.golden testsequence05_1_1.log 5-11 "Compare 5-11" 1 0
+callCompareTest testsequence_2.golden testsequence05_1_2.log 5-12 "Compare 5-12" 1 0
+callCompareTest testsequence_3.golden testsequence05_1_3.log 5-13 "Compare 5-13" 1 0
+callCompareTest testsequence_4.golden testsequence05_1_4.log 5-14 "Compare 5-14" 1 0
+callCompareTest testsequence_5.golden testsequence05_1_5.log 5-15 "Compare 5-15" 1 0
+callCompareTest testsequence_6.golden testsequence05_1_6.log 5-16 "Compare 5-16" 1 0
+callCompareTest testsequence_7.golden testsequence05_1_7.log 5-17 "Compare 5-17" 1 0
+callCompareTest testsequence_8.golden testsequence05_1_8.log 5-18 "Compare 5-18" 1 0
+callCompareTest testsequence_9.golden testsequence05_1_9.log 5-19 "Compare 5-19" 1 0
+callCompareTest testsequence_10.golden testsequence05_1_10.log 5-20 "Compare 5-20" 1 0
+
+# Broadcast to tensor_reposrc with default slot-index, and max-lag larger than slot-depth.
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=testsequence_%1d.png index=0 caps=\"image/png,framerate=(fraction)30/1\" ! pngdec ! tensor_converter ! queue ! tensor_reposink silent=false slot-index=0 slot-depth=4 broadcast=true tensor_reposrc silent=false caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! multifilesink location=testsequence06_0_%1d.log tensor_reposrc silent=false max-lag=8 caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! multifilesink location=testsequence06_1_%1d.log" 6 0 0 $PERFORMANCE
+
+callCompareTest testsequence_1.golden testsequence06_0_1.log 6-1 "Compare 6-1" 1 0
+callCompareTest testsequence_2.golden testsequence06_0_2.log 6-2 "Compare 6-2" 1 0
+callCompareTest testsequence_3.golden testsequence06_0_3.log 6-3 "Compare 6-3" 1 0
+callCompareTest testsequence_4.golden testsequence06_0_4.log 6-4 "Compare 6-4" 1 0
+callCompareTest testsequence_5.golden testsequence06_0_5.log 6-5 "Compare 6-5" 1 0
+callCompareTest testsequence_6.golden testsequence06_0_6.log 6-6 "Compare 6-6" 1 0
+callCompareTest testsequence_7.golden testsequence06_0_7.log 6-7 "Compare 6-7" 1 0
+callCompareTest testsequence_8.golden testsequence06_0_8.log 6-8 "Compare 6-8" 1 0
+callCompareTest testsequence_9.golden testsequence06_0_9.log 6-9 "Compare 6-9" 1 0
+callCompareTest testsequence_10.golden testsequence06_0_10.log 6-10 "Compare 6-10" 1 0
+
+callCompareTest testsequence_1.golden testsequence06_1_1.log 6-11 "Compare 6-11" 1 0
+callCompareTest testsequence_2.golden testsequence06_1_2.log 6-12 "Compare 6-12" 1 0
+callCompareTest testsequence_3.golden testsequence06_1_3.log 6-13 "Compare 6-13" 1 0
+callCompareTest testsequence_4.golden testsequence06_1_4.log 6-14 "Compare 6-14" 1 0
+callCompareTest testsequence_5.golden testsequence06_1_5.log 6-15 "Compare 6-15" 1 0
+callCompareTest testsequence_6.golden testsequence06_1_6.log 6-16 "Compare 6-16" 1 0
+callCompareTest testsequence_7.golden testsequence06_1_7.log 6-17 "Compare 6-17" 1 0
+callCompareTest testsequence_8.golden testsequence06_1_8.log 6-18 "Compare 6-18" 1 0
+callCompareTest testsequence_9.golden testsequence06_1_9.log 6-19 "Compare 6-19" 1 0
+callCompareTest testsequence_10.golden testsequence06_1_10.log 6-20 "Compare 6-20" 1 0
+
+# Broadcast to a slow reader with max-lag smaller than slot-depth.
+# reposink does not wait for the slow reader, the reader skips the old buffers and reads the latest 2 buffers at the end.
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=testsequence_%1d.png index=0 caps=\"image/png,framerate=(fraction)30/1\" ! pngdec ! tensor_converter ! queue ! tensor_reposink silent=false slot-index=0 slot-depth=4 broadcast=true tensor_reposrc silent=false slot-index=0 caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! multifilesink location=testsequence07_0_%1d.log tensor_reposrc silent=false slot-index=0 max-lag=2 caps=\"other/tensor,dimension=(string)3:16:16:1,type=(string)uint8,framerate=(fraction)30/1\" ! identity sleep-time=200000 ! multifilesink location=testsequence07_1_%1d.log" 7 0 0 $PERFORMANCE
+
+callCompareTest testsequence_1.golden testsequence07_0_1.log 7-1 "Compare 7-1" 1 0
+callCompareTest testsequence_2.golden testsequence07_0_2.log 7-2 "Compare 7-2" 1 0
+callCompareTest testsequence_3.golden testsequence07_0_3.log 7-3 "Compare 7-3" 1 0
+callCompareTest testsequence_4.golden testsequence07_0_4.log 7-4 "Compare 7-4" 1 0
+callCompareTest testsequence_5.golden testsequence07_0_5.log 7-5 "Compare 7-5" 1 0
+callCompareTest testsequence_6.golden testsequence07_0_6.log 7-6 "Compare 7-6" 1 0
+callCompareTest testsequence_7.golden testsequence07_0_7.log 7-7 "Compare 7-7" 1 0
+callCompareTest testsequence_8.golden testsequence07_0_8.log 7-8 "Compare 7-8" 1 0
+callCompareTest testsequence_9.golden testsequence07_0_9.log 7-9 "Compare 7-9" 1 0
+callCompareTest testsequence_10.golden testsequence07_0_10.log 7-10 "Compare 7-10" 1 0
+
+# the first buffer is dummy, the slow reader should not get all 10 buffers
+count=$(ls testsequence07_1_*.log | wc -l)
+[ ${count} -lt 11 ]
+testResult $? 7-11 "Slow reader skips the old buffers" 0 1
+
+callCompareTest testsequence_9.golden testsequence07_1_$((count - 2)).log 7-12 "Compare 7-12" 1 0
+callCompareTest testsequence_10.golden testsequence07_1_$((count - 1)).log 7-13 "Compare 7-13" 1 0
+
 report
@@ -119,6 +119,7 @@ typedef enum
   TEST_TYPE_ISSUE739_MERGE_PARALLEL_2, /**< pipeline to test Merge/Parallel case in #739 */
   TEST_TYPE_ISSUE739_MERGE_PARALLEL_3, /**< pipeline to test Merge/Parallel case in #739 */
   TEST_TYPE_ISSUE739_MERGE_PARALLEL_4, /**< pipeline to test Merge/Parallel case in #739 */
+  TEST_TYPE_MERGE_REFRESH, /**< pipeline to test tensor_merge with sync mode refresh */
   TEST_TYPE_DECODER_PROPERTY, /**< pipeline to test get/set_property of decoder */
   TEST_TYPE_UNKNOWN /**< unknonwn */
 } TestType;
@@ -887,6 +888,15 @@ _setup_pipeline (TestOption & option)
           "tensor_merge mode=linear option=3 sync_mode=basepad sync_option=1:0 name=mux ! tensor_filter framework=custom model=%s/libnnscustom_framecounter.%s ! tee name=t ! queue ! tensor_sink sync=true name=test_sink t. ! queue ! filesink location=%s",
 	   option.num_buffers * 10, custom_dir? custom_dir : "./tests", SO_EXT, option.num_buffers * 25, custom_dir? custom_dir : "./tests", SO_EXT, custom_dir? custom_dir : "./tests", SO_EXT, option.tmpfile);
       break;
+    case TEST_TYPE_MERGE_REFRESH:
+      /** 4x4 tensor stream, different FPS, tensor_merge them @ refresh (base pad 1) */
+      str_pipeline =
+          g_strdup_printf
+          ("videotestsrc pattern=snow num-buffers=%d ! video/x-raw,format=BGRx,height=4,width=4,framerate=10/1 ! tensor_converter ! tensor_filter framework=custom model=%s/libnnscustom_framecounter.%s ! mux.sink_0 "
+          "videotestsrc pattern=snow num-buffers=%d ! video/x-raw,format=BGRx,height=4,width=4,framerate=25/1 ! tensor_converter ! tensor_filter framework=custom model=%s/libnnscustom_framecounter.%s ! mux.sink_1 "
+          "tensor_merge mode=linear option=3 sync_mode=refresh sync_option=1 name=mux ! tensor_filter framework=custom model=%s/libnnscustom_framecounter.%s ! tee name=t ! queue ! tensor_sink sync=true name=test_sink t. ! queue ! filesink location=%s",
+	   option.num_buffers * 10, custom_dir? custom_dir : "./tests", SO_EXT, option.num_buffers * 25, custom_dir? custom_dir : "./tests", SO_EXT, custom_dir? custom_dir : "./tests", SO_EXT, option.tmpfile);
+      break;
     /** @todo Add tensor_mux policy = more policies! */
     case TEST_TYPE_DECODER_PROPERTY:
       str_pipeline =
@@ -4538,6 +4548,71 @@ TEST (tensor_stream_test, issue739_merge_parallel_3)
   _free_test_data ();
 }
 
+/**
+ * @brief Test tensor_merge with sync mode refresh (pushed when the base pad receives a buffer)
+ */
+TEST (tensor_stream_test, merge_refresh)
+{
+  const guint num_buffers = 2;
+  TestOption option = { num_buffers, TEST_TYPE_MERGE_REFRESH };
+
+  option.tmpfile = _get_temp_filename ();
+  EXPECT_TRUE (option.tmpfile != NULL);
+
+  ASSERT_TRUE (_setup_pipeline (option));
+
+  gst_element_set_state (g_test_data.pipeline, GST_STATE_PLAYING);
+  g_main_loop_run (g_test_data.loop);
+  gst_element_set_state (g_test_data.pipeline, GST_STATE_NULL);
+
+  /** check eos message */
+  EXPECT_EQ (g_test_data.status, TEST_EOS);
+
+  /**
+   * check received buffers
+   * the buffers of base pad before the other pad receives the first buffer may be dropped.
+   */
+  EXPECT_GT (g_test_data.received, 0U);
+  EXPECT_LE (g_test_data.received, num_buffers * 25);
+  EXPECT_EQ (g_test_data.mem_blocks, 1U);
+  EXPECT_EQ (g_test_data.received_size, 4U);     /* uint32_t, 1:1:1:1 */
+
+  /** check caps name */
+  EXPECT_TRUE (g_str_equal (g_test_data.caps_name, "other/tensor"));
+
+  /** check timestamp */
+  EXPECT_FALSE (g_test_data.invalid_timestamp);
+
+  /** check tensor config */
+  EXPECT_TRUE (gst_tensor_config_validate (&g_test_data.tensor_config));
+  EXPECT_EQ (g_test_data.tensor_config.info.type, _NNS_UINT32);
+
+  if (option.tmpfile) {
+    gchar *data;
+    gsize read, i;
+
+    if (g_file_get_contents (option.tmpfile, &data, &read, NULL)) {
+      read /= 4;
+      EXPECT_EQ (read, g_test_data.received);
+
+      /* frame counter after tensor_merge */
+      for (i = 0; i < read; i++)
+        EXPECT_EQ (((uint32_t *) data)[i], i);
+
+      g_free (data);
+    }
+
+    /* remove temp file */
+    if (g_remove (option.tmpfile) != 0) {
+      _print_log ("failed to remove temp file %s", option.tmpfile);
+    }
+    g_free (option.tmpfile);
+  }
+
+  EXPECT_FALSE (g_test_data.test_failed);
+  _free_test_data ();
+}
+
 /**
  * @brief Test get/set property of tensor_decoder
  */
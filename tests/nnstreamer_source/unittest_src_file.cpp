@@ -0,0 +1,324 @@
+/**
+ * @file	unittest_src_file.cpp
+ * @date	18 Oct 2019
+ * @brief	Unit test for tensor_src_file
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @bug		No known bugs.
+ */
+#include <string.h>
+#include <glib/gstdio.h>
+#include <gtest/gtest.h>
+#include <gst/gst.h>
+#include <gst/check/gstharness.h>
+#include <tensor_common.h>
+
+/**
+ * @brief element name to be tested
+ */
+#define ELEMENT_NAME "tensor_src_file"
+
+/**
+ * @brief size of the header in test file (aligned)
+ */
+#define TEST_HEADER_SIZE (64U)
+
+/**
+ * @brief Write the tensor file with frames, each byte of a frame is (frame index * 16 + byte index).
+ * @param path the file to be written
+ * @param caps caps string to be written in the header, NULL for raw file
+ * @param frame_size the size of a frame
+ * @param num_frames the number of frames
+ * @return TRUE if succeeded
+ */
+static gboolean
+_write_tensor_file (const gchar * path, const gchar * caps,
+    gsize frame_size, guint num_frames)
+{
+  guint8 *data;
+  gsize offset = 0, len, i, f;
+  gboolean ret;
+
+  len = frame_size * num_frames;
+  if (caps)
+    len += TEST_HEADER_SIZE;
+
+  data = (guint8 *) g_malloc0 (len);
+
+  if (caps) {
+    guint32 version = GUINT32_TO_LE (1U);
+    guint32 header_size = GUINT32_TO_LE (TEST_HEADER_SIZE);
+
+    memcpy (data, "NNSTDUMP", 8);
+    memcpy (data + 8, &version, 4);
+    memcpy (data + 12, &header_size, 4);
+    g_strlcpy ((gchar *) data + 16, caps, TEST_HEADER_SIZE - 16);
+    offset = TEST_HEADER_SIZE;
+  }
+
+  for (f = 0; f < num_frames; f++) {
+    for (i = 0; i < frame_size; i++)
+      data[offset + f * frame_size + i] = (guint8) (f * 16 + i);
+  }
+
+  ret = g_file_set_contents (path, (const gchar *) data, len, NULL);
+  g_free (data);
+  return ret;
+}
+
+/**
+ * @brief Check the frame pushed from tensor_src_file.
+ */
+static void
+_check_frame (GstBuffer * buf, guint frame_index, guint num_tensors,
+    gsize tensor_size)
+{
+  GstMemory *mem;
+  GstMapInfo map;
+  guint i;
+  gsize b;
+
+  ASSERT_TRUE (buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (buf), num_tensors);
+
+  for (i = 0; i < num_tensors; i++) {
+    mem = gst_buffer_peek_memory (buf, i);
+
+    /* wrapped (read-only) memory of the mapped file */
+    EXPECT_TRUE (GST_MEMORY_IS_READONLY (mem));
+    ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+    ASSERT_EQ (map.size, tensor_size);
+
+    for (b = 0; b < tensor_size; b++) {
+      EXPECT_EQ (map.data[b], (guint8) (frame_index * 16 + i * tensor_size + b));
+    }
+
+    gst_memory_unmap (mem, &map);
+  }
+}
+
+/**
+ * @brief Wait for EOS event in harness.
+ */
+static gboolean
+_wait_eos (GstHarness * h)
+{
+  GstEvent *event;
+  gboolean eos = FALSE;
+
+  while (!eos && (event = gst_harness_pull_event (h)) != NULL) {
+    eos = (GST_EVENT_TYPE (event) == GST_EVENT_EOS);
+    gst_event_unref (event);
+  }
+
+  return eos;
+}
+
+/**
+ * @brief Test for raw tensor file with caps property and framerate.
+ */
+TEST (test_tensor_src_file, raw_file)
+{
+  GstHarness *h;
+  GstBuffer *buf;
+  gchar *path, *desc;
+  guint i;
+
+  path = g_build_filename (g_get_tmp_dir (), "unittest_src_file_raw.dat", NULL);
+  ASSERT_TRUE (_write_tensor_file (path, NULL, 8, 4));
+
+  desc = g_strdup_printf ("%s location=%s caps=\"other/tensor,"
+      "dimension=(string)4:2:1:1,type=(string)uint8,"
+      "framerate=(fraction)10/1\"", ELEMENT_NAME, path);
+  h = gst_harness_new_parse (desc);
+  ASSERT_TRUE (h != NULL);
+
+  gst_harness_play (h);
+
+  for (i = 0; i < 4; i++) {
+    buf = gst_harness_pull (h);
+    _check_frame (buf, i, 1, 8);
+
+    EXPECT_EQ (GST_BUFFER_PTS (buf), i * GST_SECOND / 10);
+    EXPECT_EQ (GST_BUFFER_DURATION (buf), GST_SECOND / 10);
+    gst_buffer_unref (buf);
+  }
+
+  /* no more frames without loop */
+  EXPECT_TRUE (_wait_eos (h));
+  EXPECT_EQ (gst_harness_buffers_received (h), 4U);
+
+  gst_harness_teardown (h);
+  g_remove (path);
+  g_free (path);
+  g_free (desc);
+}
+
+/**
+ * @brief Test for tensor file with the header (other/tensors) and loop.
+ */
+TEST (test_tensor_src_file, header_loop)
+{
+  GstHarness *h;
+  GstBuffer *buf;
+  gchar *path, *desc;
+  guint i;
+
+  path = g_build_filename (g_get_tmp_dir (), "unittest_src_file_header.dat",
+      NULL);
+  ASSERT_TRUE (_write_tensor_file (path, "other/tensors,num_tensors=2,"
+          "dimensions=(string)\"3:1:1:1,3:1:1:1\",types=(string)\"uint8,uint8\"",
+          6, 3));
+
+  desc = g_strdup_printf ("%s location=%s loop=true", ELEMENT_NAME, path);
+  h = gst_harness_new_parse (desc);
+  ASSERT_TRUE (h != NULL);
+
+  gst_harness_play (h);
+
+  /* 3 frames in the file, repeat the frames */
+  for (i = 0; i < 7; i++) {
+    buf = gst_harness_pull (h);
+    _check_frame (buf, i % 3, 2, 3);
+
+    /* no framerate, pushed as fast as possible */
+    EXPECT_FALSE (GST_BUFFER_PTS_IS_VALID (buf));
+    EXPECT_EQ (GST_BUFFER_OFFSET (buf), i % 3);
+    gst_buffer_unref (buf);
+  }
+
+  gst_harness_teardown (h);
+  g_remove (path);
+  g_free (path);
+  g_free (desc);
+}
+
+/**
+ * @brief Test for the caps property overriding the caps in the header.
+ */
+TEST (test_tensor_src_file, header_caps_override)
+{
+  GstHarness *h;
+  GstBuffer *buf;
+  gchar *path, *desc;
+
+  path = g_build_filename (g_get_tmp_dir (), "unittest_src_file_override.dat",
+      NULL);
+  ASSERT_TRUE (_write_tensor_file (path,
+          "other/tensor,dimension=(string)4:1:1:1,type=(string)uint8", 4, 2));
+
+  desc = g_strdup_printf ("%s location=%s caps=\"other/tensor,"
+      "dimension=(string)2:1:1:1,type=(string)uint8,"
+      "framerate=(fraction)0/1\"", ELEMENT_NAME, path);
+  h = gst_harness_new_parse (desc);
+  ASSERT_TRUE (h != NULL);
+
+  gst_harness_play (h);
+
+  /* 4 frames of 2 bytes */
+  buf = gst_harness_pull (h);
+  ASSERT_TRUE (buf != NULL);
+  EXPECT_EQ (gst_buffer_get_size (buf), 2U);
+  gst_buffer_unref (buf);
+
+  EXPECT_TRUE (_wait_eos (h));
+  EXPECT_EQ (gst_harness_buffers_received (h), 4U);
+
+  gst_harness_teardown (h);
+  g_remove (path);
+  g_free (path);
+  g_free (desc);
+}
+
+/**
+ * @brief Test for raw tensor file without caps (negative).
+ */
+TEST (test_tensor_src_file, raw_file_no_caps_n)
+{
+  GstElement *src;
+  gchar *path;
+
+  path = g_build_filename (g_get_tmp_dir (), "unittest_src_file_nocaps.dat",
+      NULL);
+  ASSERT_TRUE (_write_tensor_file (path, NULL, 8, 4));
+
+  src = gst_element_factory_make (ELEMENT_NAME, NULL);
+  ASSERT_TRUE (src != NULL);
+
+  g_object_set (src, "location", path, NULL);
+  EXPECT_EQ (gst_element_set_state (src, GST_STATE_PAUSED),
+      GST_STATE_CHANGE_FAILURE);
+
+  gst_element_set_state (src, GST_STATE_NULL);
+  gst_object_unref (src);
+  g_remove (path);
+  g_free (path);
+}
+
+/**
+ * @brief Test for the caps which is not fixed (negative).
+ */
+TEST (test_tensor_src_file, unfixed_caps_n)
+{
+  GstElement *src;
+  GstCaps *caps;
+  gchar *path;
+
+  path = g_build_filename (g_get_tmp_dir (), "unittest_src_file_unfixed.dat",
+      NULL);
+  ASSERT_TRUE (_write_tensor_file (path, NULL, 8, 4));
+
+  src = gst_element_factory_make (ELEMENT_NAME, NULL);
+  ASSERT_TRUE (src != NULL);
+
+  caps = gst_caps_from_string ("other/tensor,dimension=(string)8:1:1:1,"
+      "type=(string){ uint8, int8 },framerate=(fraction)0/1");
+  g_object_set (src, "location", path, "caps", caps, NULL);
+  EXPECT_EQ (gst_element_set_state (src, GST_STATE_PAUSED),
+      GST_STATE_CHANGE_FAILURE);
+
+  gst_element_set_state (src, GST_STATE_NULL);
+  gst_object_unref (src);
+  gst_caps_unref (caps);
+  g_remove (path);
+  g_free (path);
+}
+
+/**
+ * @brief Test for the file smaller than a frame (negative).
+ */
+TEST (test_tensor_src_file, no_frame_n)
+{
+  GstElement *src;
+  GstCaps *caps;
+  gchar *path;
+
+  path = g_build_filename (g_get_tmp_dir (), "unittest_src_file_short.dat",
+      NULL);
+  ASSERT_TRUE (_write_tensor_file (path, NULL, 4, 1));
+
+  src = gst_element_factory_make (ELEMENT_NAME, NULL);
+  ASSERT_TRUE (src != NULL);
+
+  caps = gst_caps_from_string ("other/tensor,dimension=(string)8:1:1:1,"
+      "type=(string)uint8,framerate=(fraction)0/1");
+  g_object_set (src, "location", path, "caps", caps, NULL);
+  EXPECT_EQ (gst_element_set_state (src, GST_STATE_PAUSED),
+      GST_STATE_CHANGE_FAILURE);
+
+  gst_element_set_state (src, GST_STATE_NULL);
+  gst_object_unref (src);
+  gst_caps_unref (caps);
+  g_remove (path);
+  g_free (path);
+}
+
+/**
+ * @brief Main function for unit test.
+ */
+int
+main (int argc, char **argv)
+{
+  testing::InitGoogleTest (&argc, argv);
+  gst_init (&argc, &argv);
+  return RUN_ALL_TESTS ();
+}